@@ -0,0 +1,372 @@
+#ifndef RAIIGRAPH_ADJLIST_HPP
+#define RAIIGRAPH_ADJLIST_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "VectorView.hpp"
+
+#include <utility>
+
+/**
+ * @file AdjList.hpp
+ * @brief Wrappers around **igraph**'s adjacency and incidence lists with RAII behavior.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Wrapper around `igraph_adjlist_t` objects with RAII behavior.
+ *
+ * This class has ownership of the underlying `igraph_adjlist_t` object, handling both its initialization and destruction.
+ * It is move-only, as the intention is to build the list once and re-use it for many queries on the same graph.
+ * The list is independent of the graph after construction, i.e., it is not affected by any subsequent modifications to the graph.
+ *
+ * It is assumed that users have already called `igraph_setup()` or `initialize()` before constructing a instance of this class.
+ */
+class AdjList {
+public:
+    /**
+     * @param graph Pointer to an initialized **igraph** graph.
+     * @param mode Type of neighbors to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * @param loops How to report self-loops.
+     * @param multiple Whether to report multiple edges between the same pair of vertices.
+     */
+    AdjList(const igraph_t* graph, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE, igraph_multiple_t multiple = IGRAPH_MULTIPLE) {
+        check_code(igraph_adjlist_init(graph, &my_list, mode, loops, multiple));
+    }
+
+    /**
+     * @param list An initialized adjacency list to take ownership of.
+     */
+    AdjList(igraph_adjlist_t&& list) : my_list(std::move(list)) {}
+
+    /**
+     * @cond
+     */
+    AdjList(const AdjList&) = delete;
+    AdjList& operator=(const AdjList&) = delete;
+    /**
+     * @endcond
+     */
+
+    /**
+     * @param other List to be move-constructed from.
+     * This constructor does not allocate and will leave `other` as an empty list with no vertices.
+     */
+    AdjList(AdjList&& other) noexcept : my_list(other.my_list) {
+        other.my_list.adjs = NULL;
+        other.my_list.length = 0;
+    }
+
+    /**
+     * @param other List to be move-assigned from.
+     * This constructor will leave `other` in a valid but unspecified state.
+     */
+    AdjList& operator=(AdjList&& other) noexcept {
+        if (this != &other) {
+            std::swap(my_list, other.my_list);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~AdjList() {
+        if (my_list.adjs != NULL) {
+            igraph_adjlist_destroy(&my_list);
+        }
+    }
+
+public:
+    /**
+     * @return Number of vertices in the list.
+     */
+    igraph_int_t size() const {
+        return my_list.length;
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the sorted neighbors of `v`.
+     */
+    IntVectorView neighbors(igraph_int_t v) const {
+        const auto& vec = my_list.adjs[v];
+        return IntVectorView(vec.stor_begin, vec.end - vec.stor_begin);
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the sorted neighbors of `v`.
+     */
+    IntVectorView operator[](igraph_int_t v) const {
+        return neighbors(v);
+    }
+
+public:
+    /**
+     * @return Pointer to the underlying **igraph** adjacency list.
+     */
+    operator igraph_adjlist_t*() {
+        return &my_list;
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** adjacency list.
+     */
+    operator const igraph_adjlist_t*() const {
+        return &my_list;
+    }
+
+    /**
+     * @return Pointer to the underlying **igraph** adjacency list.
+     */
+    igraph_adjlist_t* get() {
+        return &my_list;
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** adjacency list.
+     */
+    const igraph_adjlist_t* get() const {
+        return &my_list;
+    }
+
+private:
+    igraph_adjlist_t my_list;
+};
+
+/**
+ * @brief Wrapper around `igraph_inclist_t` objects with RAII behavior.
+ *
+ * This class has ownership of the underlying `igraph_inclist_t` object, handling both its initialization and destruction.
+ * It is move-only, as the intention is to build the list once and re-use it for many queries on the same graph.
+ * The list is independent of the graph after construction, i.e., it is not affected by any subsequent modifications to the graph.
+ *
+ * It is assumed that users have already called `igraph_setup()` or `initialize()` before constructing a instance of this class.
+ */
+class IncList {
+public:
+    /**
+     * @param graph Pointer to an initialized **igraph** graph.
+     * @param mode Type of incident edges to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * @param loops How to report self-loops.
+     */
+    IncList(const igraph_t* graph, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE) {
+        check_code(igraph_inclist_init(graph, &my_list, mode, loops));
+    }
+
+    /**
+     * @param list An initialized incidence list to take ownership of.
+     */
+    IncList(igraph_inclist_t&& list) : my_list(std::move(list)) {}
+
+    /**
+     * @cond
+     */
+    IncList(const IncList&) = delete;
+    IncList& operator=(const IncList&) = delete;
+    /**
+     * @endcond
+     */
+
+    /**
+     * @param other List to be move-constructed from.
+     * This constructor does not allocate and will leave `other` as an empty list with no vertices.
+     */
+    IncList(IncList&& other) noexcept : my_list(other.my_list) {
+        other.my_list.incs = NULL;
+        other.my_list.length = 0;
+    }
+
+    /**
+     * @param other List to be move-assigned from.
+     * This constructor will leave `other` in a valid but unspecified state.
+     */
+    IncList& operator=(IncList&& other) noexcept {
+        if (this != &other) {
+            std::swap(my_list, other.my_list);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~IncList() {
+        if (my_list.incs != NULL) {
+            igraph_inclist_destroy(&my_list);
+        }
+    }
+
+public:
+    /**
+     * @return Number of vertices in the list.
+     */
+    igraph_int_t size() const {
+        return my_list.length;
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the IDs of the edges incident to `v`.
+     */
+    IntVectorView incident(igraph_int_t v) const {
+        const auto& vec = my_list.incs[v];
+        return IntVectorView(vec.stor_begin, vec.end - vec.stor_begin);
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the IDs of the edges incident to `v`.
+     */
+    IntVectorView operator[](igraph_int_t v) const {
+        return incident(v);
+    }
+
+public:
+    /**
+     * @return Pointer to the underlying **igraph** incidence list.
+     */
+    operator igraph_inclist_t*() {
+        return &my_list;
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** incidence list.
+     */
+    operator const igraph_inclist_t*() const {
+        return &my_list;
+    }
+
+    /**
+     * @return Pointer to the underlying **igraph** incidence list.
+     */
+    igraph_inclist_t* get() {
+        return &my_list;
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** incidence list.
+     */
+    const igraph_inclist_t* get() const {
+        return &my_list;
+    }
+
+private:
+    igraph_inclist_t my_list;
+};
+
+/**
+ * @brief Wrapper around `igraph_lazy_adjlist_t` objects with RAII behavior.
+ *
+ * This class has ownership of the underlying `igraph_lazy_adjlist_t` object, handling both its initialization and destruction.
+ * Neighbors of each vertex are only computed upon the first request, which is more efficient than `AdjList` when only a few vertices are queried.
+ * It is move-only, as the intention is to build the list once and re-use it for many queries on the same graph.
+ *
+ * Unlike `AdjList`, this class holds a pointer to the graph, which should outlive the list and should not be modified while the list is in use.
+ * Retrieving the neighbors may modify the list, so it is not safe to call `neighbors()` from multiple threads.
+ *
+ * It is assumed that users have already called `igraph_setup()` or `initialize()` before constructing a instance of this class.
+ */
+class LazyAdjList {
+public:
+    /**
+     * @param graph Pointer to an initialized **igraph** graph.
+     * @param mode Type of neighbors to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * @param loops How to report self-loops.
+     * @param multiple Whether to report multiple edges between the same pair of vertices.
+     */
+    LazyAdjList(const igraph_t* graph, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE, igraph_multiple_t multiple = IGRAPH_MULTIPLE) {
+        check_code(igraph_lazy_adjlist_init(graph, &my_list, mode, loops, multiple));
+    }
+
+    /**
+     * @cond
+     */
+    LazyAdjList(const LazyAdjList&) = delete;
+    LazyAdjList& operator=(const LazyAdjList&) = delete;
+    /**
+     * @endcond
+     */
+
+    /**
+     * @param other List to be move-constructed from.
+     * This constructor does not allocate and will leave `other` as an empty list with no vertices.
+     */
+    LazyAdjList(LazyAdjList&& other) noexcept : my_list(other.my_list) {
+        other.my_list.adjs = NULL;
+        other.my_list.length = 0;
+    }
+
+    /**
+     * @param other List to be move-assigned from.
+     * This constructor will leave `other` in a valid but unspecified state.
+     */
+    LazyAdjList& operator=(LazyAdjList&& other) noexcept {
+        if (this != &other) {
+            std::swap(my_list, other.my_list);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~LazyAdjList() {
+        if (my_list.adjs != NULL) {
+            igraph_lazy_adjlist_destroy(&my_list);
+        }
+    }
+
+public:
+    /**
+     * @return Number of vertices in the list.
+     */
+    igraph_int_t size() const {
+        return my_list.length;
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the sorted neighbors of `v`.
+     * This is computed upon the first request for `v` and cached for subsequent requests.
+     */
+    IntVectorView neighbors(igraph_int_t v) {
+        auto vec = igraph_lazy_adjlist_get(&my_list, v);
+        if (vec == NULL) {
+            throw IgraphError(IGRAPH_ENOMEM);
+        }
+        return IntVectorView(vec->stor_begin, vec->end - vec->stor_begin);
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the sorted neighbors of `v`.
+     */
+    IntVectorView operator[](igraph_int_t v) {
+        return neighbors(v);
+    }
+
+public:
+    /**
+     * @return Pointer to the underlying **igraph** lazy adjacency list.
+     */
+    operator igraph_lazy_adjlist_t*() {
+        return &my_list;
+    }
+
+    /**
+     * @return Pointer to the underlying **igraph** lazy adjacency list.
+     */
+    igraph_lazy_adjlist_t* get() {
+        return &my_list;
+    }
+
+private:
+    igraph_lazy_adjlist_t my_list;
+};
+
+}
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef RAIIGRAPH_ADJACENCY_SNAPSHOT_HPP
+#define RAIIGRAPH_ADJACENCY_SNAPSHOT_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "Vector.hpp"
+#include "VectorView.hpp"
+#include "parallelize.hpp"
+#include "IncidenceRange.hpp"
+
+#include <numeric>
+
+/**
+ * @file AdjacencySnapshot.hpp
+ * @brief Immutable compressed adjacency structure for a graph.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Immutable compressed adjacency structure for a graph.
+ *
+ * This stores the neighbors of all vertices in a single contiguous array, with an array of offsets to indicate the neighbors of each vertex (i.e., compressed sparse row format).
+ * Neighbors of each vertex are sorted in increasing order, and multi-edges are reported once per edge.
+ * Optionally, the ID of the edge to each neighbor can also be stored in a parallel array.
+ *
+ * The snapshot is independent of the graph that it was created from, i.e., it is not affected by any subsequent modifications to the graph.
+ * Neighbor access involves no allocation and no calls to **igraph**, so it is safe to use from multiple threads.
+ */
+class AdjacencySnapshot {
+public:
+    /**
+     * Default constructor, creates a snapshot of a graph with no vertices.
+     */
+    AdjacencySnapshot() : my_offsets(1) {}
+
+    /**
+     * @param graph Pointer to an initialized **igraph** graph.
+     * @param mode Type of neighbors to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * This is ignored for undirected graphs.
+     * @param loops How to report self-loops.
+     * With `IGRAPH_LOOPS_TWICE`, a self-loop is reported twice for undirected graphs or for `IGRAPH_ALL` in directed graphs.
+     * With `IGRAPH_LOOPS_ONCE`, each self-loop is reported once.
+     * With `IGRAPH_NO_LOOPS`, self-loops are not reported.
+     * @param edge_ids Whether to store the ID of the edge to each neighbor.
+     * @param num_threads Number of threads to use.
+     */
+    AdjacencySnapshot(const igraph_t* graph, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE, bool edge_ids = false, int num_threads = 1) : my_has_edges(edge_ids) {
+        if (igraph_is_directed(graph) && mode != IGRAPH_OUT && mode != IGRAPH_IN && mode != IGRAPH_ALL) {
+            throw IgraphError(IGRAPH_EINVMODE);
+        }
+
+        igraph_int_t nvertices = igraph_vcount(graph);
+        my_offsets.resize_uninitialized(nvertices + 1);
+        my_offsets[0] = 0;
+        auto optr = my_offsets.data() + 1;
+
+        // First pass to count the number of neighbors for each vertex.
+        parallelize(num_threads, nvertices, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t v = start, end = start + length; v < end; ++v) {
+                igraph_int_t count = 0;
+                for (internal::IncidenceWalker walker(graph, v, mode, loops); !walker.done(); walker.advance()) {
+                    ++count;
+                }
+                optr[v] = count;
+            }
+        });
+        std::partial_sum(optr, optr + nvertices, optr);
+
+        // Second pass to fill the neighbors.
+        igraph_int_t total = my_offsets.back();
+        my_neighbors.resize_uninitialized(total);
+        if (edge_ids) {
+            my_edges.resize_uninitialized(total);
+        }
+        auto nptr = my_neighbors.data();
+        auto eptr = my_edges.data();
+
+        parallelize(num_threads, nvertices, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t v = start, end = start + length; v < end; ++v) {
+                auto position = my_offsets[v];
+                for (internal::IncidenceWalker walker(graph, v, mode, loops); !walker.done(); walker.advance()) {
+                    nptr[position] = walker.neighbor();
+                    if (edge_ids) {
+                        eptr[position] = walker.edge();
+                    }
+                    ++position;
+                }
+            }
+        });
+    }
+
+public:
+    /**
+     * @return Number of vertices.
+     */
+    igraph_int_t vcount() const {
+        return my_offsets.size() - 1;
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return Number of neighbors of `v`.
+     */
+    igraph_int_t degree(igraph_int_t v) const {
+        return my_offsets[v + 1] - my_offsets[v];
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the sorted neighbors of `v`.
+     */
+    IntVectorView neighbors(igraph_int_t v) const {
+        return IntVectorView(my_neighbors.data() + my_offsets[v], degree(v));
+    }
+
+    /**
+     * @param v Vertex ID.
+     * @return View of the IDs of the edges to each of the neighbors in `neighbors()`.
+     * This should only be called if `has_edge_ids()` is true.
+     */
+    IntVectorView edges(igraph_int_t v) const {
+        return IntVectorView(my_edges.data() + my_offsets[v], degree(v));
+    }
+
+    /**
+     * @return Whether edge IDs were stored.
+     */
+    bool has_edge_ids() const {
+        return my_has_edges;
+    }
+
+public:
+    /**
+     * @return Vector of length equal to `vcount() + 1`.
+     * The neighbors of vertex `v` are stored in `[offsets()[v], offsets()[v + 1])` of `all_neighbors()`.
+     */
+    const IntVector& offsets() const {
+        return my_offsets;
+    }
+
+    /**
+     * @return Vector containing the neighbors of all vertices.
+     */
+    const IntVector& all_neighbors() const {
+        return my_neighbors;
+    }
+
+    /**
+     * @return Vector containing the edge IDs for all entries of `all_neighbors()`.
+     * This is empty if edge IDs were not requested.
+     */
+    const IntVector& all_edges() const {
+        return my_edges;
+    }
+
+private:
+    IntVector my_offsets;
+    IntVector my_neighbors;
+    IntVector my_edges;
+    bool my_has_edges = false;
+};
+
+}
+
+#endif
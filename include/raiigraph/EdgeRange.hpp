@@ -0,0 +1,187 @@
+#ifndef RAIIGRAPH_EDGE_RANGE_HPP
+#define RAIIGRAPH_EDGE_RANGE_HPP
+
+#include "igraph.h"
+
+#include <iterator>
+#include <cstddef>
+
+/**
+ * @file EdgeRange.hpp
+ * @brief Iterate over the edges of a graph without copying.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief An edge of a graph.
+ */
+struct Edge {
+    /**
+     * Edge ID.
+     */
+    igraph_int_t id;
+
+    /**
+     * Source vertex for directed graphs.
+     * For undirected graphs, this is the smaller of the two vertex IDs, consistent with `igraph_edge()`.
+     */
+    igraph_int_t from;
+
+    /**
+     * Target vertex for directed graphs.
+     * For undirected graphs, this is the larger of the two vertex IDs, consistent with `igraph_edge()`.
+     */
+    igraph_int_t to;
+};
+
+/**
+ * @brief Range of edges of a graph.
+ *
+ * This reads the edges directly from the internal vectors of an `igraph_t`, without any allocation or copying.
+ * It should be treated like an iterator in that it is invalidated by any modification to the graph.
+ * Sub-ranges can be created with `subrange()`, e.g., to split the edges across threads.
+ */
+class EdgeRange {
+public:
+    /**
+     * @param graph Pointer to an initialized **igraph** graph.
+     */
+    EdgeRange(const igraph_t* graph) :
+        my_first(graph->directed ? graph->from.stor_begin : graph->to.stor_begin),
+        my_second(graph->directed ? graph->to.stor_begin : graph->from.stor_begin),
+        my_start(0),
+        my_end(graph->from.end - graph->from.stor_begin)
+    {}
+
+private:
+    EdgeRange(const igraph_int_t* first, const igraph_int_t* second, igraph_int_t start, igraph_int_t end) : my_first(first), my_second(second), my_start(start), my_end(end) {}
+
+    const igraph_int_t* my_first;
+    const igraph_int_t* my_second;
+    igraph_int_t my_start, my_end;
+
+public:
+    /**
+     * @brief Random-access iterator over the edges.
+     *
+     * Dereferencing returns an `Edge` by value.
+     */
+    class Iterator {
+    public:
+        /**
+         * @cond
+         */
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef Edge value_type;
+        typedef igraph_int_t difference_type;
+        typedef const Edge* pointer;
+        typedef Edge reference;
+
+        Iterator() = default;
+        Iterator(const igraph_int_t* first, const igraph_int_t* second, igraph_int_t position) : my_first(first), my_second(second), my_position(position) {}
+
+        Edge operator*() const {
+            return Edge{ my_position, my_first[my_position], my_second[my_position] };
+        }
+
+        Edge operator[](difference_type n) const {
+            return *(*this + n);
+        }
+
+        bool operator==(const Iterator& other) const { return my_position == other.my_position; }
+        bool operator!=(const Iterator& other) const { return my_position != other.my_position; }
+        bool operator<(const Iterator& other) const { return my_position < other.my_position; }
+        bool operator>(const Iterator& other) const { return my_position > other.my_position; }
+        bool operator<=(const Iterator& other) const { return my_position <= other.my_position; }
+        bool operator>=(const Iterator& other) const { return my_position >= other.my_position; }
+
+        Iterator& operator++() { ++my_position; return *this; }
+        Iterator operator++(int) { auto copy = *this; ++my_position; return copy; }
+        Iterator& operator--() { --my_position; return *this; }
+        Iterator operator--(int) { auto copy = *this; --my_position; return copy; }
+
+        Iterator& operator+=(difference_type n) { my_position += n; return *this; }
+        Iterator& operator-=(difference_type n) { my_position -= n; return *this; }
+        Iterator operator+(difference_type n) const { auto copy = *this; copy.my_position += n; return copy; }
+        Iterator operator-(difference_type n) const { auto copy = *this; copy.my_position -= n; return copy; }
+        friend Iterator operator+(difference_type n, Iterator it) { it.my_position += n; return it; }
+        difference_type operator-(const Iterator& other) const { return my_position - other.my_position; }
+        /**
+         * @endcond
+         */
+
+    private:
+        const igraph_int_t* my_first = NULL;
+        const igraph_int_t* my_second = NULL;
+        igraph_int_t my_position = 0;
+    };
+
+public:
+    /**
+     * @return Number of edges in the range.
+     */
+    igraph_int_t size() const {
+        return my_end - my_start;
+    }
+
+    /**
+     * @return Whether the range is empty.
+     */
+    bool empty() const {
+        return my_end == my_start;
+    }
+
+    /**
+     * @param i Index of the edge in this range.
+     * @return The `i`-th edge in this range.
+     */
+    Edge operator[](igraph_int_t i) const {
+        auto e = my_start + i;
+        return Edge{ e, my_first[e], my_second[e] };
+    }
+
+    /**
+     * @return Iterator to the first edge in this range.
+     */
+    Iterator begin() const {
+        return Iterator(my_first, my_second, my_start);
+    }
+
+    /**
+     * @return Iterator to the end of this range.
+     */
+    Iterator end() const {
+        return Iterator(my_first, my_second, my_end);
+    }
+
+    /**
+     * @param start Index of the first edge of the sub-range, relative to the start of this range.
+     * @param length Number of edges in the sub-range.
+     * @return A range containing the specified subset of edges.
+     */
+    EdgeRange subrange(igraph_int_t start, igraph_int_t length) const {
+        return EdgeRange(my_first, my_second, my_start + start, my_start + start + length);
+    }
+
+public:
+    /**
+     * @return Pointer to an array of length equal to the number of edges in the graph, containing the `Edge::from` vertex for each edge.
+     * This is indexed by the edge ID, not by the position in this range.
+     */
+    const igraph_int_t* from_data() const {
+        return my_first;
+    }
+
+    /**
+     * @return Pointer to an array of length equal to the number of edges in the graph, containing the `Edge::to` vertex for each edge.
+     * This is indexed by the edge ID, not by the position in this range.
+     */
+    const igraph_int_t* to_data() const {
+        return my_second;
+    }
+};
+
+}
+
+#endif
@@ -3,7 +3,17 @@
 
 #include "igraph.h"
 #include "Vector.hpp"
+#include "MatrixView.hpp"
 #include "error.hpp"
+#include "AdjacencySnapshot.hpp"
+#include "EdgeRange.hpp"
+#include "IncidenceRange.hpp"
+#include "parallelize.hpp"
+
+#include <cstring>
+#include <vector>
+#include <algorithm>
+#include <numeric>
 
 /**
  * @file Graph.hpp
@@ -12,6 +22,16 @@
 
 namespace raiigraph {
 
+/**
+ * How to handle reciprocal neighbors in `Graph::from_neighbors()`,
+ * i.e., pairs of vertices where each vertex is a neighbor of the other.
+ *
+ * - `NONE`: each neighbor yields its own edge, so reciprocal neighbors are connected by two edges.
+ * - `UNION`: reciprocal neighbors are connected by a single edge, while all other neighbors still yield an edge.
+ * - `INTERSECTION`: only reciprocal neighbors are connected by a single edge, i.e., a mutual nearest-neighbor graph.
+ */
+enum class SymmetrizeMode : char { NONE, UNION, INTERSECTION };
+
 /**
  * @brief Wrapper around `igraph_t` objects with RAII behavior. 
  *
@@ -27,6 +47,105 @@ private:
         check_code(igraph_empty(&my_graph, num_vertices, directed));
     }
 
+    // Moved-from graphs have NULL storage to avoid an allocation in the move constructor.
+    // We lazily re-initialize them before they are used in any igraph function.
+    igraph_t* restore() {
+        if (my_graph.from.stor_begin == NULL) {
+            setup(0, false);
+        }
+        return &my_graph;
+    }
+
+    // Copying the contents of 'source' into our existing vectors, so that no
+    // reallocation is required if our capacity is already large enough.
+    void update(const igraph_t& source) {
+        constexpr igraph_vector_int_t igraph_t::* members[] = { &igraph_t::from, &igraph_t::to, &igraph_t::oi, &igraph_t::ii, &igraph_t::os, &igraph_t::is };
+
+        // Reserving everything first, so that a failed allocation leaves us in a consistent state.
+        for (auto m : members) {
+            check_code(igraph_vector_int_reserve(&(my_graph.*m), igraph_vector_int_size(&(source.*m))));
+        }
+        for (auto m : members) {
+            check_code(igraph_vector_int_update(&(my_graph.*m), &(source.*m)));
+        }
+
+        my_graph.n = source.n;
+        my_graph.directed = source.directed;
+        igraph_invalidate_cache(&my_graph); // cached properties refer to the old graph.
+    }
+
+    // Building the indices of 'graph' after its 'from' and 'to' vectors are filled.
+    // This uses a stable counting sort by the secondary and then the primary vertex,
+    // so that each index is ordered by (primary, secondary, edge ID) like igraph_create().
+    static void index_edges(igraph_t& graph) {
+        igraph_int_t nedges = igraph_vector_int_size(&graph.from);
+        igraph_int_t nvertices = graph.n;
+        check_code(igraph_vector_int_resize(&graph.oi, nedges));
+        check_code(igraph_vector_int_resize(&graph.ii, nedges));
+        check_code(igraph_vector_int_resize(&graph.os, nvertices + 1));
+        check_code(igraph_vector_int_resize(&graph.is, nvertices + 1));
+
+        std::vector<igraph_int_t> buffer(nedges), counts(nvertices + 1);
+        auto order = [&](const igraph_int_t* primary, const igraph_int_t* secondary, igraph_int_t* index, igraph_int_t* starts) -> void {
+            std::fill(counts.begin(), counts.end(), 0);
+            for (igraph_int_t e = 0; e < nedges; ++e) {
+                ++counts[secondary[e] + 1];
+            }
+            std::partial_sum(counts.begin(), counts.end(), counts.begin());
+            for (igraph_int_t e = 0; e < nedges; ++e) {
+                buffer[counts[secondary[e]]++] = e;
+            }
+
+            std::fill(starts, starts + nvertices + 1, 0);
+            for (igraph_int_t e = 0; e < nedges; ++e) {
+                ++starts[primary[e] + 1];
+            }
+            std::partial_sum(starts, starts + nvertices + 1, starts);
+            std::copy(starts, starts + nvertices, counts.begin());
+            for (auto e : buffer) {
+                index[counts[primary[e]]++] = e;
+            }
+        };
+
+        order(graph.from.stor_begin, graph.to.stor_begin, graph.oi.stor_begin, graph.os.stor_begin);
+        order(graph.to.stor_begin, graph.from.stor_begin, graph.ii.stor_begin, graph.is.stor_begin);
+        igraph_invalidate_cache(&graph);
+    }
+
+    // Const access to a moved-from graph returns this empty graph instead, so that const methods never modify the object.
+    static const igraph_t* empty_placeholder() {
+        struct Holder {
+            Holder() {
+                check_code(igraph_empty(&graph, 0, false));
+
+                // igraph caches some properties by writing through a const pointer, so we fill the cache now;
+                // otherwise, const queries on different moved-from graphs would race on this shared object.
+                igraph_bool_t res;
+                check_code(igraph_has_loop(&graph, &res));
+                check_code(igraph_has_multiple(&graph, &res));
+                check_code(igraph_has_mutual(&graph, &res, false));
+                check_code(igraph_has_mutual(&graph, &res, true));
+                check_code(igraph_is_connected(&graph, &res, IGRAPH_WEAK));
+                check_code(igraph_is_connected(&graph, &res, IGRAPH_STRONG));
+                check_code(igraph_is_forest(&graph, &res, NULL, IGRAPH_ALL));
+                check_code(igraph_is_dag(&graph, &res));
+                check_code(igraph_is_acyclic(&graph, &res));
+            }
+            ~Holder() {
+                igraph_destroy(&graph);
+            }
+            igraph_t graph;
+        };
+        static const Holder holder;
+        return &(holder.graph);
+    }
+
+    void release_storage() noexcept {
+        // Zeroing the structure ensures that all internal vectors have NULL storage,
+        // along with NULL pointers for the attributes and the property cache.
+        std::memset(static_cast<void*>(&my_graph), 0, sizeof(igraph_t));
+    }
+
 public:
     /**
      * Create an empty graph, i.e., with no edges.
@@ -64,40 +183,162 @@ public:
      */
     Graph(igraph_t&& graph) : my_graph(std::move(graph)) {}
 
+    /**
+     * Create a graph from the nearest neighbors of each vertex, e.g., from a k-nearest neighbor search.
+     * The graph's internal edge vectors are filled directly from `neighbors`, without creating an intermediate edge list.
+     *
+     * Without symmetrization, edges are ordered by the first vertex and then by the rank of the neighbor.
+     * With symmetrization, the edge between reciprocal neighbors is reported in the position of the vertex with the smaller ID.
+     *
+     * @param neighbors Matrix of neighbor indices, where each row corresponds to a vertex and each column corresponds to the rank of a neighbor.
+     * That is, the `j`-th column of row `i` contains the `j + 1`-th nearest neighbor of vertex `i`.
+     * All indices should be less than the number of rows, and each row should not contain duplicate indices.
+     * Vertices cannot be their own neighbors, as self-loops would not be handled consistently across the `SymmetrizeMode` choices.
+     * An `IntMatrix` can also be supplied here.
+     * @param directed Whether the graph is directed.
+     * If true, each edge is directed from a vertex to its neighbor, and `symmetrize` must be `SymmetrizeMode::NONE`.
+     * @param symmetrize How to handle reciprocal neighbors in an undirected graph.
+     * @param num_threads Number of threads to use.
+     * @return The graph, with one vertex per row of `neighbors`.
+     * An `IgraphError` is thrown if any index is out of range or refers to its own row.
+     */
+    static Graph from_neighbors(const IntMatrixView& neighbors, igraph_bool_t directed, SymmetrizeMode symmetrize = SymmetrizeMode::NONE, int num_threads = 1) {
+        if (directed && symmetrize != SymmetrizeMode::NONE) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+
+        igraph_int_t nobs = neighbors.nrow();
+        igraph_int_t k = neighbors.ncol();
+        const igraph_int_t* ptr = neighbors.data(); // column-major, so the r-th neighbor of i is at 'ptr[i + r * nobs]'.
+        for (igraph_int_t r = 0; r < k; ++r) {
+            auto current = ptr + r * nobs;
+            for (igraph_int_t i = 0; i < nobs; ++i) {
+                if (current[i] < 0 || current[i] >= nobs) {
+                    throw IgraphError(IGRAPH_EINVVID);
+                }
+                if (current[i] == i) {
+                    throw IgraphError(IGRAPH_EINVAL);
+                }
+            }
+        }
+
+        // An edge from 'i' to its neighbor 'n' is kept if it is not reciprocated (for UNION) or if 'i' is the smaller ID in a reciprocal pair.
+        auto keep = [&](igraph_int_t i, igraph_int_t n) -> bool {
+            if (symmetrize == SymmetrizeMode::NONE) {
+                return true;
+            }
+            bool reciprocal = false;
+            for (igraph_int_t r = 0; r < k; ++r) {
+                if (ptr[n + r * nobs] == i) {
+                    reciprocal = true;
+                    break;
+                }
+            }
+            if (reciprocal) {
+                return i < n;
+            } else {
+                return symmetrize == SymmetrizeMode::UNION;
+            }
+        };
+
+        // First pass to count the number of edges for each vertex.
+        std::vector<igraph_int_t> offsets(nobs + 1);
+        if (symmetrize == SymmetrizeMode::NONE) {
+            for (igraph_int_t i = 0; i < nobs; ++i) {
+                offsets[i + 1] = (i + 1) * k;
+            }
+        } else {
+            parallelize(num_threads, nobs, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+                for (igraph_int_t i = start, end = start + length; i < end; ++i) {
+                    igraph_int_t count = 0;
+                    for (igraph_int_t r = 0; r < k; ++r) {
+                        count += keep(i, ptr[i + r * nobs]);
+                    }
+                    offsets[i + 1] = count;
+                }
+            });
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+        }
+
+        igraph_t tmp;
+        check_code(igraph_empty(&tmp, nobs, directed));
+        Graph output(std::move(tmp));
+        auto& graph = output.my_graph;
+        check_code(igraph_vector_int_resize(&graph.from, offsets.back()));
+        check_code(igraph_vector_int_resize(&graph.to, offsets.back()));
+
+        // Second pass to fill the edges. igraph stores the larger vertex in 'from' for undirected graphs.
+        auto fptr = graph.from.stor_begin;
+        auto tptr = graph.to.stor_begin;
+        parallelize(num_threads, nobs, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t i = start, end = start + length; i < end; ++i) {
+                auto position = offsets[i];
+                for (igraph_int_t r = 0; r < k; ++r) {
+                    auto n = ptr[i + r * nobs];
+                    if (!keep(i, n)) {
+                        continue;
+                    }
+                    if (directed) {
+                        fptr[position] = i;
+                        tptr[position] = n;
+                    } else {
+                        fptr[position] = std::max(i, n);
+                        tptr[position] = std::min(i, n);
+                    }
+                    ++position;
+                }
+            }
+        });
+
+        index_edges(graph);
+        return output;
+    }
+
 public:
     /**
      * @param other Graph to be copy-constructed from.
      */
     Graph(const Graph& other) {
-        check_code(igraph_copy(&my_graph, &(other.my_graph)));
+        check_code(igraph_copy(&my_graph, other.get()));
     }
 
     /**
      * @param other Graph to be copy-assigned from.
+     * If neither graph has attributes, the existing storage of this graph is re-used where possible.
      */
     Graph& operator=(const Graph& other) {
         if (this != &other) {
-            check_code(igraph_copy(&my_graph, &(other.my_graph)));
+            const igraph_t* source = other.get();
+            if (my_graph.from.stor_begin == NULL) {
+                check_code(igraph_copy(&my_graph, source));
+            } else if (my_graph.attr == NULL && source->attr == NULL) {
+                update(*source);
+            } else {
+                igraph_t tmp;
+                check_code(igraph_copy(&tmp, source));
+                igraph_destroy(&my_graph);
+                my_graph = tmp;
+            }
         }
         return *this;
     }
 
     /**
      * @param other Graph to be move-constructed from.
-     * This constructor will leave `other` in a valid but unspecified state.
+     * This constructor does not allocate and will leave `other` as an empty undirected graph with no vertices.
+     * Any subsequent use of `other` in an **igraph** function (e.g., via `get()`) will re-initialize it.
      */
-    Graph(Graph&& other) {
-        setup(0, false);
-        std::swap(my_graph, other.my_graph);
+    Graph(Graph&& other) noexcept : my_graph(other.my_graph) {
+        other.release_storage();
     }    
 
     /**
      * @param other Graph to be move-assigned from.
      * This constructor will leave `other` in a valid but unspecified state.
      */
-    Graph& operator=(Graph&& other) {
+    Graph& operator=(Graph&& other) noexcept {
         if (this != &other) {
-            std::swap(my_graph, other.my_graph);
+            std::swap(my_graph, other.my_graph); // 'other' gets our storage, which is either initialized or lazily restored on use.
         }
         return *this;
     }
@@ -106,7 +347,9 @@ public:
      * Destructor.
      */
     ~Graph() {
-        igraph_destroy(&my_graph);
+        if (my_graph.from.stor_begin != NULL) {
+            igraph_destroy(&my_graph);
+        }
     }
 
 public:
@@ -114,14 +357,14 @@ public:
      * @return Number of vertices in the graph.
      */
     igraph_int_t vcount() const {
-        return igraph_vcount(&my_graph);
+        return my_graph.n;
     }
 
     /**
      * @return Number of edges in the graph.
      */
     igraph_int_t ecount() const {
-        return igraph_ecount(&my_graph);
+        return my_graph.from.end - my_graph.from.stor_begin;
     }
 
     /**
@@ -131,17 +374,82 @@ public:
      * If `by_col = false`, this is the same as the sequence of edges used in the constructor.
      */
     IntVector get_edgelist(igraph_bool_t by_col = false) const {
-        IntVector out(ecount());
-        check_code(igraph_get_edgelist(&my_graph, out.get(), by_col));
+        IntVector out(ecount() * 2, uninitialized);
+        get_edgelist(out, by_col);
         return out;
     }
 
+    /**
+     * This overload re-uses the memory in `out`, only reallocating if its capacity is insufficient.
+     * It avoids repeated allocations when extracting edges from many graphs in a loop.
+     *
+     * @param[out] out Vector to store the edges.
+     * On output, this is resized to `2 * ecount()` and filled with the edge list, see the other overload for details.
+     * @param by_col Whether to return the edges in a column-major array.
+     */
+    void get_edgelist(IntVector& out, igraph_bool_t by_col = false) const {
+        check_code(igraph_get_edgelist(get(), out.get(), by_col));
+    }
+
+    /**
+     * Iterate over the edges of the graph without copying, e.g., to compute edge statistics on very large graphs.
+     *
+     * @return Range of edges, where each edge is represented by its ID and connected vertices.
+     * For undirected graphs, the first vertex of each edge is the smaller of the two, consistent with `igraph_edge()`.
+     * The range is invalidated by any modification to the graph.
+     */
+    EdgeRange edges() const {
+        return EdgeRange(&my_graph); // no need to restore() a moved-from graph, as it just yields an empty range.
+    }
+
+    /**
+     * Iterate over the neighbors of a vertex without allocation, e.g., for traversals that only visit a few vertices.
+     * This is equivalent to `igraph_neighbors()` but reads directly from the graph's internal indices.
+     *
+     * @param v Vertex ID, which should be less than `vcount()`.
+     * @param mode Type of neighbors to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * @param loops How to report self-loops.
+     * @return Range of neighboring vertices, sorted in increasing order.
+     * The range is invalidated by any modification to the graph.
+     */
+    NeighborRange neighbors(igraph_int_t v, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE) const {
+        return NeighborRange(&my_graph, v, mode, loops);
+    }
+
+    /**
+     * Iterate over the edges incident to a vertex without allocation.
+     * This is equivalent to `igraph_incident()` but reads directly from the graph's internal indices.
+     *
+     * @param v Vertex ID, which should be less than `vcount()`.
+     * @param mode Type of incident edges to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * @param loops How to report self-loops.
+     * @return Range of edge IDs, sorted by the ID of the vertex at the other end of each edge.
+     * The range is invalidated by any modification to the graph.
+     */
+    IncidentRange incident(igraph_int_t v, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE) const {
+        return IncidentRange(&my_graph, v, mode, loops);
+    }
+
+    /**
+     * Create a compressed snapshot of the adjacency structure of this graph, see `AdjacencySnapshot` for details.
+     * This is useful for custom traversals that need to repeatedly access the neighbors of each vertex.
+     *
+     * @param mode Type of neighbors to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * @param loops How to report self-loops.
+     * @param edge_ids Whether to store the ID of the edge to each neighbor.
+     * @param num_threads Number of threads to use.
+     * @return The adjacency snapshot.
+     */
+    AdjacencySnapshot adjacency_snapshot(igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE, bool edge_ids = false, int num_threads = 1) const {
+        return AdjacencySnapshot(get(), mode, loops, edge_ids, num_threads);
+    }
+
 public:
     /**
      * @return Whether the graph is directed.
      */
     igraph_bool_t is_directed() const {
-        return igraph_is_directed(&my_graph);
+        return my_graph.directed;
     }
 
     /**
@@ -152,7 +460,7 @@ public:
      */
     igraph_bool_t is_connected(igraph_connectedness_t mode = IGRAPH_WEAK) const {
         igraph_bool_t res;
-        check_code(igraph_is_connected(&my_graph, &res, mode));
+        check_code(igraph_is_connected(get(), &res, mode));
         return res;
     }
 
@@ -164,7 +472,7 @@ public:
      */
     igraph_bool_t is_simple(igraph_bool_t directed) const {
         igraph_bool_t res;
-        check_code(igraph_is_simple(&my_graph, &res, directed));
+        check_code(igraph_is_simple(get(), &res, directed));
         return res;
     }
 
@@ -173,7 +481,7 @@ public:
      */
     igraph_bool_t has_loop() const {
         igraph_bool_t res;
-        check_code(igraph_has_loop(&my_graph, &res));
+        check_code(igraph_has_loop(get(), &res));
         return res;
     }
 
@@ -182,7 +490,7 @@ public:
      */
     igraph_bool_t has_multiple() const {
         igraph_bool_t res;
-        check_code(igraph_has_multiple(&my_graph, &res));
+        check_code(igraph_has_multiple(get(), &res));
         return res;
     }
 
@@ -192,7 +500,7 @@ public:
      */
     igraph_bool_t has_mutual(igraph_bool_t loops = false) const {
         igraph_bool_t res;
-        check_code(igraph_has_mutual(&my_graph, &res, loops));
+        check_code(igraph_has_mutual(get(), &res, loops));
         return res;
     }
 
@@ -204,7 +512,7 @@ public:
      */
     bool is_tree(igraph_neimode_t mode = IGRAPH_ALL) const {
         igraph_bool_t res;
-        check_code(igraph_is_tree(&my_graph, &res, NULL, mode));
+        check_code(igraph_is_tree(get(), &res, NULL, mode));
         return res;
     }
 
@@ -214,7 +522,7 @@ public:
      */
     bool is_forest(igraph_neimode_t mode = IGRAPH_ALL) const {
         igraph_bool_t res;
-        check_code(igraph_is_forest(&my_graph, &res, NULL, mode));
+        check_code(igraph_is_forest(get(), &res, NULL, mode));
         return res;
     }
 
@@ -223,7 +531,7 @@ public:
      */
     bool is_dag() const {
         igraph_bool_t res;
-        check_code(igraph_is_dag(&my_graph, &res));
+        check_code(igraph_is_dag(get(), &res));
         return res;
     }
 
@@ -232,7 +540,7 @@ public:
      */
     bool is_acyclic() const {
         igraph_bool_t res;
-        check_code(igraph_is_acyclic(&my_graph, &res));
+        check_code(igraph_is_acyclic(get(), &res));
         return res;
     }
 
@@ -242,7 +550,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     operator igraph_t*() {
-        return &my_graph;
+        return restore();
     }
 
     /**
@@ -250,7 +558,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     operator const igraph_t*() const {
-        return &my_graph;
+        return get();
     }
 
     /**
@@ -258,14 +566,20 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     igraph_t* get() {
-        return &my_graph;
+        return restore();
     }
 
     /**
      * @return Pointer to the underlying **igraph** graph.
      * This is guaranteed to be non-NULL and initialized.
+     * For a moved-from graph, this points to an empty graph that is shared by all moved-from instances.
+     * Its property cache is already filled, so it can be safely queried from multiple threads by the const methods of this class,
+     * but it should not be passed to other **igraph** functions that might modify the cache through a const pointer.
      */
     const igraph_t* get() const {
+        if (my_graph.from.stor_begin == NULL) {
+            return empty_placeholder();
+        }
         return &my_graph;
     }
 
@@ -0,0 +1,225 @@
+#ifndef RAIIGRAPH_GRAPH_BUILDER_HPP
+#define RAIIGRAPH_GRAPH_BUILDER_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "Vector.hpp"
+#include "Graph.hpp"
+#include "parallelize.hpp"
+#include "algorithms.hpp"
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <numeric>
+
+/**
+ * @file GraphBuilder.hpp
+ * @brief Assemble a graph from edges that are generated in parallel.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Assemble a graph from edges that are generated in parallel.
+ *
+ * Each worker appends edges to its own buffer, which is split into fixed-size chunks so that no existing edges need to be copied when the buffer grows.
+ * This allows multiple threads to add edges concurrently without any synchronization, as long as each thread uses a different worker index.
+ * Once all edges are added, `build()` copies the chunks into a single edge array that is used to create the `Graph`.
+ * Each chunk is released as soon as its edges are copied, so the peak memory usage is roughly that of a single edge array.
+ */
+class GraphBuilder {
+public:
+    /**
+     * @param num_vertices Number of vertices in the graph.
+     * @param directed Whether the graph is directed.
+     * @param num_workers Number of workers that will add edges.
+     * Each worker should only be used by one thread at a time, e.g., the worker index supplied by `parallelize()`.
+     * @param chunk_size Number of edges in each chunk of a worker's buffer.
+     */
+    GraphBuilder(igraph_int_t num_vertices, igraph_bool_t directed, int num_workers = 1, igraph_int_t chunk_size = 65536) :
+        my_num_vertices(num_vertices), my_directed(directed), my_chunk_size(chunk_size), my_workers(std::max(num_workers, 1))
+    {
+        if (num_vertices < 0 || chunk_size <= 0) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+    }
+
+private:
+    typedef std::vector<igraph_int_t> Chunk;
+
+    // Aligned to avoid false sharing when different threads append to adjacent workers.
+    struct alignas(64) Worker {
+        std::vector<Chunk> chunks;
+    };
+
+    igraph_int_t my_num_vertices;
+    igraph_bool_t my_directed;
+    igraph_int_t my_chunk_size;
+    std::vector<Worker> my_workers;
+
+public:
+    /**
+     * Add an edge to the graph.
+     *
+     * @param worker Index of the worker, less than the `num_workers` used in the constructor.
+     * @param from First vertex of the edge.
+     * @param to Second vertex of the edge.
+     */
+    void add_edge(int worker, igraph_int_t from, igraph_int_t to) {
+        if (from < 0 || from >= my_num_vertices || to < 0 || to >= my_num_vertices) {
+            throw IgraphError(IGRAPH_EINVVID);
+        }
+
+        auto& chunks = my_workers[worker].chunks;
+        if (chunks.empty() || static_cast<igraph_int_t>(chunks.back().size()) == 2 * my_chunk_size) {
+            chunks.emplace_back();
+            chunks.back().reserve(2 * my_chunk_size);
+        }
+        auto& current = chunks.back();
+        current.push_back(from);
+        current.push_back(to);
+    }
+
+    /**
+     * Add multiple edges to the graph.
+     *
+     * @param worker Index of the worker, less than the `num_workers` used in the constructor.
+     * @param edges Pointer to an array of length `2 * num_edges`, where the `i`-th edge is defined from `edges[2 * i]` to `edges[2 * i + 1]`.
+     * @param num_edges Number of edges to add.
+     */
+    void add_edges(int worker, const igraph_int_t* edges, igraph_int_t num_edges) {
+        for (igraph_int_t e = 0; e < num_edges; ++e) {
+            add_edge(worker, edges[2 * e], edges[2 * e + 1]);
+        }
+    }
+
+    /**
+     * @return Number of edges that have been added across all workers.
+     */
+    igraph_int_t num_edges() const {
+        igraph_int_t total = 0;
+        for (const auto& w : my_workers) {
+            for (const auto& c : w.chunks) {
+                total += c.size();
+            }
+        }
+        return total / 2;
+    }
+
+    /**
+     * @return Number of workers.
+     */
+    int num_workers() const {
+        return my_workers.size();
+    }
+
+private:
+    template<class Store_>
+    void consume_chunks(bool remove_loops, int num_threads, Store_& store) {
+        int nworkers = my_workers.size();
+
+        // First pass to count the number of edges to be kept from each worker.
+        std::vector<igraph_int_t> offsets(nworkers + 1);
+        parallelize(num_threads, nworkers, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t w = start, end = start + length; w < end; ++w) {
+                igraph_int_t count = 0;
+                for (const auto& c : my_workers[w].chunks) {
+                    if (remove_loops) {
+                        for (std::size_t i = 0, csize = c.size(); i < csize; i += 2) {
+                            count += (c[i] != c[i + 1]);
+                        }
+                    } else {
+                        count += c.size() / 2;
+                    }
+                }
+                offsets[w + 1] = count;
+            }
+        });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        store.allocate(offsets.back());
+
+        // Second pass to copy each worker's edges into its own section of the output, releasing each chunk once it is copied.
+        parallelize(num_threads, nworkers, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t w = start, end = start + length; w < end; ++w) {
+                auto position = offsets[w];
+                auto& chunks = my_workers[w].chunks;
+                for (auto& c : chunks) {
+                    for (std::size_t i = 0, csize = c.size(); i < csize; i += 2) {
+                        if (!remove_loops || c[i] != c[i + 1]) {
+                            store.set(position, c[i], c[i + 1]);
+                            ++position;
+                        }
+                    }
+                    Chunk().swap(c);
+                }
+                std::vector<Chunk>().swap(chunks);
+            }
+        });
+    }
+
+public:
+    /**
+     * Build the graph from all edges that have been added.
+     * Without `remove_multiple`, the edges are ordered by worker index and then by the order in which they were added within each worker.
+     * With `remove_multiple`, the edges are sorted by their first and then second vertex, where the first vertex is the smaller of the two for undirected graphs.
+     * The builder is left empty after this method is called, so new edges can be added to build another graph.
+     *
+     * @param remove_loops Whether to remove self-loops.
+     * @param remove_multiple Whether to remove duplicate edges between the same pair of vertices.
+     * This requires a temporary array of unique edges in addition to the array of all edges.
+     * @param num_threads Number of threads to use.
+     * @return The graph.
+     */
+    Graph build(bool remove_loops = false, bool remove_multiple = false, int num_threads = 1) {
+        if (!remove_multiple) {
+            struct {
+                IntVector edges;
+                void allocate(igraph_int_t n) { edges.resize_uninitialized(2 * n); }
+                void set(igraph_int_t i, igraph_int_t from, igraph_int_t to) {
+                    edges[2 * i] = from;
+                    edges[2 * i + 1] = to;
+                }
+            } store;
+            consume_chunks(remove_loops, num_threads, store);
+            return Graph(store.edges, my_num_vertices, my_directed);
+        }
+
+        typedef std::pair<igraph_int_t, igraph_int_t> Pair;
+        struct {
+            std::vector<Pair> pairs;
+            bool directed;
+            void allocate(igraph_int_t n) { pairs.resize(n); }
+            void set(igraph_int_t i, igraph_int_t from, igraph_int_t to) {
+                if (!directed && from > to) {
+                    std::swap(from, to);
+                }
+                pairs[i].first = from;
+                pairs[i].second = to;
+            }
+        } store;
+        store.directed = my_directed;
+        consume_chunks(remove_loops, num_threads, store);
+
+        auto& pairs = store.pairs;
+        parallel_sort(pairs.begin(), pairs.end(), num_threads);
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+        IntVector edges;
+        edges.resize_uninitialized(2 * pairs.size());
+        parallelize(num_threads, pairs.size(), [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t i = start, end = start + length; i < end; ++i) {
+                edges[2 * i] = pairs[i].first;
+                edges[2 * i + 1] = pairs[i].second;
+            }
+        });
+        std::vector<Pair>().swap(pairs);
+
+        return Graph(edges, my_num_vertices, my_directed);
+    }
+};
+
+}
+
+#endif
@@ -0,0 +1,227 @@
+#ifndef RAIIGRAPH_INCIDENCE_RANGE_HPP
+#define RAIIGRAPH_INCIDENCE_RANGE_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+
+#include <iterator>
+#include <cstddef>
+
+/**
+ * @file IncidenceRange.hpp
+ * @brief Iterate over the neighbors or incident edges of a vertex without allocation.
+ */
+
+namespace raiigraph {
+
+/**
+ * @cond
+ */
+namespace internal {
+
+// Walks through the edges incident to a vertex in order of increasing neighbor ID, by merging igraph's
+// internal out- and in-indices (which are already sorted by the neighboring vertex).
+class IncidenceWalker {
+public:
+    IncidenceWalker() = default;
+
+    IncidenceWalker(const igraph_t* graph, igraph_int_t v, igraph_neimode_t mode, igraph_loops_t loops) :
+        my_from(graph->from.stor_begin), my_to(graph->to.stor_begin), my_oi(graph->oi.stor_begin), my_ii(graph->ii.stor_begin), my_vertex(v)
+    {
+        bool directed = graph->directed;
+        bool use_out = !directed || mode == IGRAPH_OUT || mode == IGRAPH_ALL;
+        bool use_in = !directed || mode == IGRAPH_IN || mode == IGRAPH_ALL;
+        if (!use_out && !use_in) {
+            throw IgraphError(IGRAPH_EINVMODE);
+        }
+
+        if (use_out) {
+            my_opos = graph->os.stor_begin[v];
+            my_oend = graph->os.stor_begin[v + 1];
+        }
+        if (use_in) {
+            my_ipos = graph->is.stor_begin[v];
+            my_iend = graph->is.stor_begin[v + 1];
+        }
+
+        // If we're using both directions, a self-loop is present in both the outgoing and incoming edges.
+        my_skip_in_loops = (loops == IGRAPH_NO_LOOPS || (loops == IGRAPH_LOOPS_ONCE && use_out));
+        my_skip_out_loops = (loops == IGRAPH_NO_LOOPS);
+        settle();
+    }
+
+private:
+    const igraph_int_t* my_from = NULL;
+    const igraph_int_t* my_to = NULL;
+    const igraph_int_t* my_oi = NULL;
+    const igraph_int_t* my_ii = NULL;
+    igraph_int_t my_vertex = 0;
+    igraph_int_t my_opos = 0, my_oend = 0, my_ipos = 0, my_iend = 0;
+    bool my_skip_out_loops = false, my_skip_in_loops = false;
+    bool my_take_out = false;
+
+    // Choosing the next entry and skipping any self-loops that should not be reported.
+    void settle() {
+        while (my_opos < my_oend || my_ipos < my_iend) {
+            if (my_opos == my_oend) {
+                my_take_out = false;
+            } else if (my_ipos == my_iend) {
+                my_take_out = true;
+            } else {
+                my_take_out = my_to[my_oi[my_opos]] <= my_from[my_ii[my_ipos]];
+            }
+
+            if (my_take_out) {
+                if (!my_skip_out_loops || my_to[my_oi[my_opos]] != my_vertex) {
+                    return;
+                }
+                ++my_opos;
+            } else {
+                if (!my_skip_in_loops || my_from[my_ii[my_ipos]] != my_vertex) {
+                    return;
+                }
+                ++my_ipos;
+            }
+        }
+    }
+
+public:
+    bool done() const {
+        return my_opos == my_oend && my_ipos == my_iend;
+    }
+
+    igraph_int_t edge() const {
+        return (my_take_out ? my_oi[my_opos] : my_ii[my_ipos]);
+    }
+
+    igraph_int_t neighbor() const {
+        return (my_take_out ? my_to[my_oi[my_opos]] : my_from[my_ii[my_ipos]]);
+    }
+
+    void advance() {
+        if (my_take_out) {
+            ++my_opos;
+        } else {
+            ++my_ipos;
+        }
+        settle();
+    }
+
+    bool same_position(const IncidenceWalker& other) const {
+        return my_opos == other.my_opos && my_ipos == other.my_ipos;
+    }
+
+    IncidenceWalker finished() const {
+        auto copy = *this;
+        copy.my_opos = my_oend;
+        copy.my_ipos = my_iend;
+        return copy;
+    }
+};
+
+}
+/**
+ * @endcond
+ */
+
+/**
+ * @brief Range of neighbors or incident edges of a vertex.
+ *
+ * @tparam edges_ Whether to report the IDs of the incident edges instead of the neighboring vertices.
+ *
+ * This reads directly from the internal indices of an `igraph_t`, without any allocation or calls to **igraph** functions.
+ * Entries are reported in order of increasing neighbor ID, consistent with `igraph_neighbors()` and `igraph_incident()`.
+ * The range should be treated like an iterator in that it is invalidated by any modification to the graph.
+ */
+template<bool edges_>
+class IncidenceRange {
+public:
+    /**
+     * @param graph Pointer to an initialized **igraph** graph.
+     * @param v Vertex ID.
+     * @param mode Type of neighbors to report for directed graphs, i.e., `IGRAPH_OUT`, `IGRAPH_IN` or `IGRAPH_ALL`.
+     * This is ignored for undirected graphs.
+     * @param loops How to report self-loops.
+     * With `IGRAPH_LOOPS_TWICE`, a self-loop is reported twice for undirected graphs or for `IGRAPH_ALL` in directed graphs.
+     * With `IGRAPH_LOOPS_ONCE`, each self-loop is reported once.
+     * With `IGRAPH_NO_LOOPS`, self-loops are not reported.
+     */
+    IncidenceRange(const igraph_t* graph, igraph_int_t v, igraph_neimode_t mode = IGRAPH_OUT, igraph_loops_t loops = IGRAPH_LOOPS_TWICE) : my_walker(graph, v, mode, loops) {}
+
+private:
+    internal::IncidenceWalker my_walker;
+
+public:
+    /**
+     * @brief Forward iterator over the range.
+     */
+    class Iterator {
+    public:
+        /**
+         * @cond
+         */
+        typedef std::forward_iterator_tag iterator_category;
+        typedef igraph_int_t value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const igraph_int_t* pointer;
+        typedef igraph_int_t reference;
+
+        Iterator() = default;
+        Iterator(internal::IncidenceWalker walker) : my_walker(walker) {}
+
+        igraph_int_t operator*() const {
+            if constexpr(edges_) {
+                return my_walker.edge();
+            } else {
+                return my_walker.neighbor();
+            }
+        }
+
+        bool operator==(const Iterator& other) const { return my_walker.same_position(other.my_walker); }
+        bool operator!=(const Iterator& other) const { return !my_walker.same_position(other.my_walker); }
+
+        Iterator& operator++() { my_walker.advance(); return *this; }
+        Iterator operator++(int) { auto copy = *this; my_walker.advance(); return copy; }
+        /**
+         * @endcond
+         */
+
+    private:
+        internal::IncidenceWalker my_walker;
+    };
+
+    /**
+     * @return Iterator to the first entry.
+     */
+    Iterator begin() const {
+        return Iterator(my_walker);
+    }
+
+    /**
+     * @return Iterator to the end of the range.
+     */
+    Iterator end() const {
+        return Iterator(my_walker.finished());
+    }
+
+    /**
+     * @return Whether the range is empty.
+     */
+    bool empty() const {
+        return my_walker.done();
+    }
+};
+
+/**
+ * Range of neighboring vertices.
+ */
+typedef IncidenceRange<false> NeighborRange;
+
+/**
+ * Range of incident edges.
+ */
+typedef IncidenceRange<true> IncidentRange;
+
+}
+
+#endif
@@ -4,9 +4,13 @@
 #include "igraph.h"
 #include "error.hpp"
 #include "Vector.hpp"
+#include "parallelize.hpp"
 
 #include <algorithm>
 #include <iterator>
+#include <cstring>
+#include <tuple>
+#include <utility>
 
 /**
  * @file Matrix.hpp
@@ -15,6 +19,48 @@
 
 namespace raiigraph {
 
+/**
+ * @cond
+ */
+namespace internal {
+
+// Side length of the square tiles used in the blocked transpose. A pair of
+// 32x32 tiles of 8-byte values occupies 16 kB, fitting comfortably in L1.
+constexpr igraph_int_t transpose_tile = 32;
+
+// Writes the transpose of the column-major 'nr' x 'nc' matrix in 'input' to
+// 'output', which is equivalent to a row-major copy of 'input'. The input is
+// processed in tiles so that the strided accesses stay in cache.
+template<typename Value_>
+void blocked_transpose(const Value_* input, igraph_int_t nr, igraph_int_t nc, Value_* output, int num_threads) {
+    igraph_int_t num_row_tiles = nr / transpose_tile + (nr % transpose_tile > 0);
+
+    // Each worker handles a contiguous set of input rows, i.e., a disjoint set of output columns.
+    parallelize(num_threads, num_row_tiles, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+        igraph_int_t rfirst = start * transpose_tile;
+        igraph_int_t rlast = std::min(nr, (start + length) * transpose_tile);
+
+        for (igraph_int_t r0 = rfirst; r0 < rlast; r0 += transpose_tile) {
+            igraph_int_t r1 = std::min(rlast, r0 + transpose_tile);
+            for (igraph_int_t c0 = 0; c0 < nc; c0 += transpose_tile) {
+                igraph_int_t c1 = std::min(nc, c0 + transpose_tile);
+                for (igraph_int_t r = r0; r < r1; ++r) {
+                    auto out = output + r * nc;
+                    auto in = input + r;
+                    for (igraph_int_t c = c0; c < c1; ++c) {
+                        out[c] = in[c * nr];
+                    }
+                }
+            }
+        }
+    });
+}
+
+}
+/**
+ * @endcond
+ */
+
 /**
  * @brief Wrapper around `igraph_matrix_*_t` objects with RAII behavior.
  * @tparam Ns_ Structure-based namespace with static methods, internal use only.
@@ -32,6 +78,62 @@ private:
         check_code(Ns_::init(&my_matrix, nr, nc));
     }
 
+    void setup_uninitialized(igraph_int_t nr, igraph_int_t nc) {
+        if (nr < 0 || nc < 0) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+        if (nc && nr > IGRAPH_INTEGER_MAX / nc) {
+            throw IgraphError(IGRAPH_EOVERFLOW);
+        }
+        internal::allocate_uninitialized(my_matrix.data, nr * nc);
+        my_matrix.nrow = nr;
+        my_matrix.ncol = nc;
+    }
+
+    // Moved-from matrices have NULL storage to avoid an allocation in the move constructor.
+    // We lazily re-initialize them before they are used in any igraph function.
+    typename Ns_::igraph_type* restore() {
+        if (my_matrix.data.stor_begin == NULL) {
+            setup(0, 0);
+        }
+        return &my_matrix;
+    }
+
+    // Const access to a moved-from matrix returns this empty matrix instead, so that const methods never modify the object.
+    static const typename Ns_::igraph_type* empty_placeholder() {
+        static typename Ns_::value_type dummy{}; // igraph asserts that the storage is non-NULL, even for empty matrices.
+        static const typename Ns_::igraph_type empty = []() {
+            typename Ns_::igraph_type output;
+            output.data.stor_begin = &dummy;
+            output.data.stor_end = &dummy;
+            output.data.end = &dummy;
+            output.nrow = 0;
+            output.ncol = 0;
+            return output;
+        }();
+        return &empty;
+    }
+
+    void release_storage() noexcept {
+        my_matrix.data.stor_begin = NULL;
+        my_matrix.data.stor_end = NULL;
+        my_matrix.data.end = NULL;
+        my_matrix.nrow = 0;
+        my_matrix.ncol = 0;
+    }
+
+    // Growing the capacity geometrically, so that repeated calls to add_rows() or add_cols() do not reallocate every time.
+    void reserve_geometric(igraph_int_t new_size) {
+        igraph_int_t old_capacity = my_matrix.data.stor_end - my_matrix.data.stor_begin;
+        if (new_size > old_capacity) {
+            igraph_int_t target = new_size;
+            if (old_capacity <= IGRAPH_INTEGER_MAX / 2) {
+                target = std::max(target, old_capacity * 2);
+            }
+            check_code(Ns_::reserve(restore(), target));
+        }
+    }
+
 public:
     /**
      * Type of the underlying **igraph** matrix.
@@ -100,10 +202,18 @@ public:
      * @param val Value to use to fill the matrix.
      */
     Matrix(size_type nr, size_type nc, const value_type& val = value_type()) {
-        setup(nr, nc);
-        if (val != 0) { // setup() already zero-initializes the backing array.
-            std::fill(begin(), end(), val);
-        }
+        setup_uninitialized(nr, nc); // avoid zeroing the memory before filling it.
+        std::fill(begin(), end(), val);
+    }
+
+    /**
+     * @param nr Number of rows in the matrix.
+     * @param nc Number of columns in the matrix.
+     * @param tag Tag to indicate that the matrix contents should not be initialized.
+     * All values are unspecified until they are explicitly set by the caller.
+     */
+    Matrix(size_type nr, size_type nc, [[maybe_unused]] UninitializedTag tag) {
+        setup_uninitialized(nr, nc);
     }
 
     /**
@@ -117,7 +227,7 @@ public:
      * This constructor will make a deep copy.
      */
     Matrix(const Matrix<Ns_>& other) {
-        check_code(Ns_::copy(&my_matrix, &(other.my_matrix)));
+        check_code(Ns_::copy(&my_matrix, other.get()));
     }
 
     /**
@@ -126,28 +236,31 @@ public:
      */
     Matrix<Ns_>& operator=(const Matrix<Ns_>& other) {
         if (this != &other) {
-            // my_matrix should already be initialized before the assignment.
-            check_code(Ns_::update(&my_matrix, &(other.my_matrix)));
+            if (my_matrix.data.stor_begin == NULL) {
+                check_code(Ns_::copy(&my_matrix, other.get()));
+            } else {
+                check_code(Ns_::update(&my_matrix, other.get()));
+            }
         }
         return *this;
     }
 
     /**
      * @param other Matrix to be move-constructed from.
-     * This constructor will leave `other` in a valid but unspecified state.
+     * This constructor does not allocate and will leave `other` as an empty matrix with no rows or columns.
+     * Any subsequent use of `other` in an **igraph** function (e.g., via `get()`) will re-initialize it.
      */
-    Matrix(Matrix<Ns_>&& other) {
-        setup(0, 0); // we must leave 'other' in a valid state.
-        std::swap(my_matrix, other.my_matrix);
+    Matrix(Matrix<Ns_>&& other) noexcept : my_matrix(other.my_matrix) {
+        other.release_storage();
     }
 
     /**
      * @param other Matrix to be move-assigned from.
      * This constructor will leave `other` in a valid but unspecified state.
      */
-    Matrix& operator=(Matrix<Ns_>&& other) {
+    Matrix& operator=(Matrix<Ns_>&& other) noexcept {
         if (this != &other) {
-            std::swap(my_matrix, other.my_matrix); // 'my_matrix' should already be initialized, so we're leaving 'other' in a valid state.
+            std::swap(my_matrix, other.my_matrix); // 'other' gets our storage, which is either initialized or lazily restored on use.
         }
         return *this;
     }
@@ -156,7 +269,9 @@ public:
      * Destructor.
      */
     ~Matrix() {
-        Ns_::destroy(&my_matrix);
+        if (my_matrix.data.stor_begin != NULL) {
+            Ns_::destroy(&my_matrix);
+        }
     }
 
 public:
@@ -164,14 +279,14 @@ public:
      * @return Whether the matrix is empty.
      */
     igraph_bool_t empty() const {
-        return Ns_::empty(&my_matrix);
+        return size() == 0;
     }
 
     /**
      * @return Size of the matrix.
      */
     size_type size() const {
-        return Ns_::size(&my_matrix);
+        return my_matrix.nrow * my_matrix.ncol;
     }
 
     /**
@@ -219,18 +334,131 @@ public:
      */
     void resize(size_type nr, size_type nc, value_type val = value_type()) {
         auto old_size = this->size();
-        check_code(Ns_::resize(&my_matrix, nr, nc));
+        check_code(Ns_::resize(restore(), nr, nc));
         auto new_size = this->size();
         if (old_size < new_size) {
             std::fill_n(begin() + old_size, new_size - old_size, val);
         }
     }
 
+    /**
+     * Resize the matrix to the specified number of rows and columns, without initializing any new elements.
+     * Existing values are preserved in the same manner as described for `resize()`.
+     * This is more efficient than `resize()` when the caller will immediately overwrite the new elements.
+     *
+     * @param nr New number of rows.
+     * @param nc New number of columns.
+     */
+    void resize_uninitialized(size_type nr, size_type nc) {
+        check_code(Ns_::resize(restore(), nr, nc));
+    }
+
+    /**
+     * Resize the matrix to the specified number of rows and columns, preserving the 2-dimensional layout of the existing values.
+     * That is, the value at `(r, c)` in the original matrix is still located at `(r, c)` in the resized matrix, as long as `r < nr` and `c < nc`.
+     * Columns are shifted in place within the existing allocation, so no new matrix is allocated if the capacity is sufficient.
+     *
+     * @param nr New number of rows.
+     * @param nc New number of columns.
+     * @param val Value to use to fill the new elements, i.e., those in new rows or columns.
+     */
+    void resize_preserve(size_type nr, size_type nc, value_type val = value_type()) {
+        if (nr < 0 || nc < 0) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+        if (nc && nr > IGRAPH_INTEGER_MAX / nc) {
+            throw IgraphError(IGRAPH_EOVERFLOW);
+        }
+
+        auto old_nr = nrow(), old_nc = ncol();
+        auto old_size = size(), new_size = nr * nc;
+        if (new_size > old_size) {
+            check_code(Ns_::resize(restore(), nr, nc)); // expanding the storage before shifting columns towards the back.
+        }
+
+        auto ptr = my_matrix.data.stor_begin;
+        auto kept_nc = std::min(nc, old_nc);
+        if (nr > old_nr) {
+            // Going from back to front so that we don't overwrite columns that haven't been moved yet.
+            for (size_type c = kept_nc; c > 0; --c) {
+                auto src = ptr + (c - 1) * old_nr;
+                auto dest = ptr + (c - 1) * nr;
+                std::memmove(dest, src, sizeof(value_type) * static_cast<std::size_t>(old_nr));
+                std::fill(dest + old_nr, dest + nr, val);
+            }
+        } else if (nr < old_nr) {
+            for (size_type c = 1; c < kept_nc; ++c) {
+                std::memmove(ptr + c * nr, ptr + c * old_nr, sizeof(value_type) * static_cast<std::size_t>(nr));
+            }
+        }
+
+        if (new_size <= old_size) {
+            check_code(Ns_::resize(restore(), nr, nc)); // shrinking the storage after shifting columns towards the front.
+        }
+        std::fill(begin() + kept_nc * nr, end(), val);
+    }
+
+    /**
+     * Add new rows to the end of the matrix, preserving the 2-dimensional layout of the existing values.
+     * The capacity is increased geometrically so that repeated calls do not reallocate every time.
+     * Note that each call still needs to shift all existing columns, so it takes time proportional to `size()`.
+     * Where possible, users should prefer `add_cols()` or transpose their matrix.
+     *
+     * @param n Number of rows to add.
+     * @param val Value to use to fill the new rows.
+     */
+    void add_rows(size_type n, value_type val = value_type()) {
+        auto nr = nrow() + n, nc = ncol();
+        if (nc && nr > IGRAPH_INTEGER_MAX / nc) {
+            throw IgraphError(IGRAPH_EOVERFLOW);
+        }
+        reserve_geometric(nr * nc);
+        resize_preserve(nr, nc, val);
+    }
+
+    /**
+     * Add new columns to the end of the matrix, preserving the existing values.
+     * The capacity is increased geometrically so that repeated calls take amortized time proportional to the number of new elements.
+     *
+     * @param n Number of columns to add.
+     * @param val Value to use to fill the new columns.
+     */
+    void add_cols(size_type n, value_type val = value_type()) {
+        auto nr = nrow(), nc = ncol() + n;
+        if (nc && nr > IGRAPH_INTEGER_MAX / nc) {
+            throw IgraphError(IGRAPH_EOVERFLOW);
+        }
+        reserve_geometric(nr * nc);
+        resize(nr, nc, val); // column-major order means that the flat resize already preserves the layout.
+    }
+
+    /**
+     * Reserve capacity for the matrix contents, avoiding reallocations for subsequent resizing.
+     * @param n Number of elements to reserve space for.
+     */
+    void reserve(size_type n) {
+        check_code(Ns_::reserve(restore(), n));
+    }
+
     /**
      * Shrink the capacity of the matrix to fit the contents.
      */
     void shrink_to_fit() {
-        Ns_::shrink_to_fit(&my_matrix);
+        Ns_::shrink_to_fit(restore());
+    }
+
+    /**
+     * Release ownership of the underlying array to the caller, without copying its contents.
+     * This matrix is subsequently left with no rows or columns, as if it were moved from.
+     *
+     * @return Tuple containing a pointer to the column-major array, the number of rows and the number of columns.
+     * The array is freed by `igraph_free()` when the pointer goes out of scope.
+     */
+    std::tuple<IgraphPointer<value_type>, size_type, size_type> release() {
+        auto nr = nrow(), nc = ncol();
+        IgraphPointer<value_type> output(my_matrix.data.stor_begin);
+        release_storage();
+        return std::make_tuple(std::move(output), nr, nc);
     }
 
 public:
@@ -308,7 +536,7 @@ public:
      * @return Iterator to the end of this matrix.
      */
     iterator end() {
-        return my_matrix.data.stor_end;
+        return my_matrix.data.end;
     }
 
     /**
@@ -336,7 +564,7 @@ public:
      * @return Const iterator to the end of this matrix.
      */
     const_iterator cend() const {
-        return my_matrix.data.stor_end;
+        return my_matrix.data.end;
     }
 
     /**
@@ -649,6 +877,165 @@ public:
         }
     };
 
+    /**
+     * @brief View into a rectangular block of the matrix.
+     *
+     * @tparam BaseIterator Internal use only. 
+     * @tparam BaseReference Internal use only. 
+     *
+     * This provides 2-dimensional access to a contiguous range of rows and columns of the matrix, e.g., a submatrix of distances or affinities.
+     * Each column of the block is a contiguous segment of the parent matrix, which can be accessed directly via `column_data()`.
+     * The block can be further divided into cache-sized tiles with `block()` or `for_each_tile()`.
+     * Blocks should be treated like iterators in that they are potentially invalidated by any re/deallocations in the parent `Matrix`. 
+     */
+    template<typename BaseIterator, typename BaseReference>
+    class Block {
+    /**
+     * @cond
+     */
+    public:
+        Block(BaseIterator start, size_type nr, size_type nc, size_type stride) : start(start), nr(nr), nc(nc), stride(stride) {}
+
+    private:
+        BaseIterator start;
+        size_type nr, nc, stride;
+    /**
+     * @endcond
+     */
+
+    public:
+        /**
+         * @return Number of rows in the block.
+         */
+        size_type nrow() const {
+            return nr;
+        }
+
+        /**
+         * @return Number of columns in the block.
+         */
+        size_type ncol() const {
+            return nc;
+        }
+
+        /**
+         * @return Number of elements in the block.
+         */
+        size_type size() const {
+            return nr * nc;
+        }
+
+        /**
+         * @return Whether the block is empty.
+         */
+        bool empty() const {
+            return size() == 0;
+        }
+
+        /**
+         * @return Distance between the starts of consecutive columns of the block, i.e., the number of rows in the parent matrix.
+         */
+        size_type leading_dimension() const {
+            return stride;
+        }
+
+        /**
+         * @param r Row of interest, relative to the start of the block.
+         * @param c Column of interest, relative to the start of the block.
+         * @return Reference to the value at `(r, c)` of the block.
+         */
+        BaseReference operator()(size_type r, size_type c) const {
+            return *(start + r + c * stride);
+        }
+
+        /**
+         * @param c Column of interest, relative to the start of the block.
+         * @return Pointer to the start of the contiguous segment of `nrow()` values for column `c`.
+         */
+        BaseIterator column_data(size_type c) const {
+            return start + c * stride;
+        }
+
+        /**
+         * @param c Column of interest, relative to the start of the block.
+         * @return A view on the column of the block.
+         */
+        View<BaseIterator, BaseReference> column(size_type c) const {
+            return View<BaseIterator, BaseReference>(start + c * stride, 1, nr);
+        }
+
+        /**
+         * @param r Row of interest, relative to the start of the block.
+         * @return A view on the row of the block.
+         */
+        View<BaseIterator, BaseReference> row(size_type r) const {
+            return View<BaseIterator, BaseReference>(start + r, stride, nc);
+        }
+
+        /**
+         * @param r0 First row of the sub-block, relative to the start of this block.
+         * @param c0 First column of the sub-block, relative to the start of this block.
+         * @param sub_nr Number of rows in the sub-block.
+         * @param sub_nc Number of columns in the sub-block.
+         * @return View into the sub-block.
+         * An `IgraphError` is thrown if the sub-block extends beyond this block.
+         */
+        Block block(size_type r0, size_type c0, size_type sub_nr, size_type sub_nc) const {
+            if (r0 < 0 || c0 < 0 || sub_nr < 0 || sub_nc < 0 || r0 > nr - sub_nr || c0 > nc - sub_nc) {
+                throw IgraphError(IGRAPH_EINVAL);
+            }
+            return Block(start + r0 + c0 * stride, sub_nr, sub_nc, stride);
+        }
+
+        /**
+         * Split this block into tiles and apply a function to each tile.
+         * Tiles are visited in column-major order, i.e., all tiles in the first column of tiles are visited before moving to the next column.
+         * Tiles at the bottom and right edges may be smaller than the requested size.
+         *
+         * @tparam Function_ Function to apply to each tile.
+         * @param tile_nr Maximum number of rows in each tile, should be positive.
+         * @param tile_nc Maximum number of columns in each tile, should be positive.
+         * @param fun Function that accepts the row and column of the tile's top-left corner (relative to this block) and a `Block` for the tile.
+         */
+        template<class Function_>
+        void for_each_tile(size_type tile_nr, size_type tile_nc, Function_ fun) const {
+            if (tile_nr <= 0 || tile_nc <= 0) {
+                throw IgraphError(IGRAPH_EINVAL);
+            }
+            for (size_type c0 = 0; c0 < nc; c0 += std::min(tile_nc, nc - c0)) {
+                auto cur_nc = std::min(tile_nc, nc - c0);
+                for (size_type r0 = 0; r0 < nr; r0 += std::min(tile_nr, nr - r0)) {
+                    auto cur_nr = std::min(tile_nr, nr - r0);
+                    fun(r0, c0, Block(start + r0 + c0 * stride, cur_nr, cur_nc, stride));
+                }
+            }
+        }
+    };
+
+    /**
+     * @param r0 First row of the block.
+     * @param c0 First column of the block.
+     * @param nr Number of rows in the block.
+     * @param nc Number of columns in the block.
+     * @return A view on the block.
+     * An `IgraphError` is thrown if the block extends beyond the matrix.
+     */
+    Block<iterator, reference> block(size_type r0, size_type c0, size_type nr, size_type nc) {
+        return Block<iterator, reference>(begin(), nrow(), ncol(), nrow()).block(r0, c0, nr, nc);
+    }
+
+    /**
+     * @param r0 First row of the block.
+     * @param c0 First column of the block.
+     * @param nr Number of rows in the block.
+     * @param nc Number of columns in the block.
+     * @return A const view on the block.
+     * An `IgraphError` is thrown if the block extends beyond the matrix.
+     */
+    Block<const_iterator, const_reference> block(size_type r0, size_type c0, size_type nr, size_type nc) const {
+        return Block<const_iterator, const_reference>(begin(), nrow(), ncol(), nrow()).block(r0, c0, nr, nc);
+    }
+
     /**
      * @param r Row of interest.
      * @return A view on the row.
@@ -670,11 +1057,23 @@ public:
      * @return An **igraph** vector containing a copy of the row contents.
      */
     vector_type row_copy(size_type r) const {
-        vector_type output(ncol());
-        check_code(Ns_::get_row(&my_matrix, output.get(), r));
+        vector_type output(ncol(), uninitialized);
+        row_copy(r, output);
         return output;
     }
 
+    /**
+     * This overload re-uses the memory in `output`, only reallocating if its capacity is insufficient.
+     * It avoids repeated allocations when copying many rows in a loop.
+     *
+     * @param r Row of interest.
+     * @param[out] output An **igraph** vector.
+     * On output, this is resized to `ncol()` and filled with a copy of the row contents.
+     */
+    void row_copy(size_type r, vector_type& output) const {
+        check_code(Ns_::get_row(get(), output.get(), r));
+    }
+
     /**
      * @param c Column of interest.
      * @return A view on the column.
@@ -696,18 +1095,57 @@ public:
      * @return An **igraph** vector containing a copy of the column contents.
      */
     vector_type column_copy(size_type c) const {
-        vector_type output(nrow());
-        check_code(Ns_::get_col(&my_matrix, output.get(), c));
+        vector_type output(nrow(), uninitialized);
+        column_copy(c, output);
         return output;
     }
 
+    /**
+     * This overload re-uses the memory in `output`, only reallocating if its capacity is insufficient.
+     * It avoids repeated allocations when copying many columns in a loop.
+     *
+     * @param c Column of interest.
+     * @param[out] output An **igraph** vector.
+     * On output, this is resized to `nrow()` and filled with a copy of the column contents.
+     */
+    void column_copy(size_type c, vector_type& output) const {
+        check_code(Ns_::get_col(get(), output.get(), c));
+    }
+
+public:
+    /**
+     * Create the transpose of this matrix.
+     * This processes the matrix in cache-sized tiles, avoiding the cache misses from a naive element-wise traversal of a tall matrix.
+     *
+     * @param num_threads Number of threads to use.
+     * @return Matrix with `ncol()` rows and `nrow()` columns, where each row contains the contents of the corresponding column of this matrix.
+     */
+    Matrix<Ns_> transpose(int num_threads = 1) const {
+        Matrix<Ns_> output(ncol(), nrow(), uninitialized);
+        internal::blocked_transpose(data(), nrow(), ncol(), output.data(), num_threads);
+        return output;
+    }
+
+    /**
+     * Copy the contents of this matrix into a row-major array.
+     * This is the same as `transpose()` but writes to a caller-supplied buffer, e.g., for libraries that expect row-major coordinates.
+     *
+     * @param[out] buffer Pointer to an array of length equal to `size()`.
+     * On output, the value at `(r, c)` is stored at `buffer[r * ncol() + c]`.
+     * This should not overlap with the contents of this matrix.
+     * @param num_threads Number of threads to use.
+     */
+    void to_row_major(value_type* buffer, int num_threads = 1) const {
+        internal::blocked_transpose(data(), nrow(), ncol(), buffer, num_threads);
+    }
+
 public:
     /**
      * @return Pointer to the underlying **igraph** matrix object.
      * This is guaranteed to be non-NULL and initialized.
      */
     operator igraph_type*() {
-        return &my_matrix;
+        return restore();
     }
 
     /**
@@ -715,7 +1153,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     operator const igraph_type*() const {
-        return &my_matrix;
+        return get();
     }
 
     /**
@@ -723,7 +1161,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     igraph_type* get() {
-        return &my_matrix;
+        return restore();
     }
 
     /**
@@ -731,6 +1169,9 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     const igraph_type* get() const {
+        if (my_matrix.data.stor_begin == NULL) {
+            return empty_placeholder();
+        }
         return &my_matrix;
     }
 
@@ -739,7 +1180,7 @@ public:
      * Swap two matrixs, maintaining the validity of existing pointers to each matrix and its elements.
      * @param other Matrix to be swapped.
      */
-    void swap(Matrix<Ns_>& other)  {
+    void swap(Matrix<Ns_>& other) noexcept {
         // Swapping structures entirely to ensure that iterators and pointers
         // remain valid; looks like igraph_matrix_swap does the same.
         std::swap(my_matrix, other.my_matrix);
@@ -0,0 +1,333 @@
+#ifndef RAIIGRAPH_MATRIX_VIEW_HPP
+#define RAIIGRAPH_MATRIX_VIEW_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "Matrix.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file MatrixView.hpp
+ * @brief Read-only view of external memory as an `igraph_matrix_*_t`.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Read-only view of external memory as an `igraph_matrix_*_t`.
+ * @tparam Ns_ Structure-based namespace with static methods, internal use only.
+ *
+ * This class wraps an existing column-major array (e.g., from a `std::vector` or a `Matrix`) without copying its contents.
+ * It provides the same read-only accessors as `Matrix` and can be passed directly to **igraph** functions that accept a const pointer to a matrix.
+ * The view does not own the underlying array, so users should ensure that the array outlives the view and is not reallocated while the view is in use.
+ */
+template<class Ns_>
+class MatrixView {
+public:
+    /**
+     * Type of the underlying **igraph** matrix.
+     */
+    typedef typename Ns_::igraph_type igraph_type;
+
+    /**
+     * Type of the values inside the matrix.
+     */
+    typedef typename Ns_::value_type value_type;
+
+    /**
+     * Type of a const reference to values inside the matrix.
+     */
+    typedef const value_type& const_reference;
+
+    /**
+     * Type of the reference to values inside the matrix.
+     * This is the same as `const_reference` as views are read-only.
+     */
+    typedef const_reference reference;
+
+    /**
+     * Integer type for the size of the matrix.
+     */
+    typedef igraph_int_t size_type;
+
+    /**
+     * Integer type for differences in positions within the matrix.
+     */
+    typedef igraph_int_t difference_type;
+
+    /**
+     * Const iterator for the matrix contents.
+     */
+    typedef const value_type* const_iterator;
+
+    /**
+     * Iterator for the matrix contents.
+     * This is the same as `const_iterator` as views are read-only.
+     */
+    typedef const_iterator iterator;
+
+    /**
+     * Reverse const iterator for the matrix contents.
+     */
+    typedef std::reverse_iterator<const_iterator> reverse_const_iterator;
+
+    /**
+     * View into a row or column of the matrix.
+     */
+    typedef typename Matrix<Ns_>::template View<const_iterator, const_reference> View;
+
+    /**
+     * View into a rectangular block of the matrix.
+     */
+    typedef typename Matrix<Ns_>::template Block<const_iterator, const_reference> Block;
+
+private:
+    static const value_type* placeholder() {
+        // igraph asserts that the storage is non-NULL, even for empty matrices.
+        static const value_type dummy{};
+        return &dummy;
+    }
+
+public:
+    /**
+     * Default constructor, creates a view with no rows or columns.
+     */
+    MatrixView() : MatrixView(NULL, 0, 0) {}
+
+    /**
+     * @param data Pointer to the start of a column-major array of length equal to `nr * nc`.
+     * This may be NULL if the array is of length zero.
+     * @param nr Number of rows.
+     * @param nc Number of columns.
+     */
+    MatrixView(const value_type* data, size_type nr, size_type nc) {
+        if (nr < 0 || nc < 0) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+        if (nc && nr > IGRAPH_INTEGER_MAX / nc) {
+            throw IgraphError(IGRAPH_EOVERFLOW);
+        }
+
+        // Same as what igraph_matrix_view() does.
+        auto ptr = const_cast<value_type*>(data == NULL ? placeholder() : data);
+        my_matrix.data.stor_begin = ptr;
+        my_matrix.data.stor_end = ptr + nr * nc;
+        my_matrix.data.end = my_matrix.data.stor_end;
+        my_matrix.nrow = nr;
+        my_matrix.ncol = nc;
+    }
+
+    /**
+     * @tparam Container_ Contiguous container that provides the `data()` and `size()` methods, e.g., `std::vector`, `Vector`.
+     * @param container Instance of a contiguous container, containing the matrix contents in column-major order.
+     * @param nr Number of rows.
+     * @param nc Number of columns.
+     * The product of `nr` and `nc` should be equal to the size of `container`.
+     */
+    template<class Container_, typename = typename std::enable_if<std::is_convertible<decltype(std::declval<const Container_&>().data()), const value_type*>::value>::type>
+    MatrixView(const Container_& container, size_type nr, size_type nc) : MatrixView(container.data(), nr, nc) {
+        if (static_cast<size_type>(container.size()) != nr * nc) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+    }
+
+    /**
+     * @param matrix Matrix to be viewed.
+     */
+    MatrixView(const Matrix<Ns_>& matrix) : MatrixView(matrix.data(), matrix.nrow(), matrix.ncol()) {}
+
+public:
+    /**
+     * @return Whether the matrix is empty.
+     */
+    bool empty() const {
+        return size() == 0;
+    }
+
+    /**
+     * @return Size of the matrix.
+     */
+    size_type size() const {
+        return my_matrix.nrow * my_matrix.ncol;
+    }
+
+    /**
+     * @return Number of rows in the matrix.
+     */
+    size_type nrow() const {
+        return my_matrix.nrow;
+    }
+
+    /**
+     * @return Number of columns in the matrix.
+     */
+    size_type ncol() const {
+        return my_matrix.ncol;
+    }
+
+    /**
+     * @param i Index on the matrix.
+     * @return Const reference to the value at `i`.
+     */
+    const_reference operator[](size_type i) const {
+        return *(begin() + i);
+    }
+
+    /**
+     * @param r Row of interest.
+     * @param c Column of interest.
+     * @return Const reference to the value at `(r, c)`.
+     */
+    const_reference operator()(size_type r, size_type c) const {
+        return *(begin() + r + c * my_matrix.nrow);
+    }
+
+    /**
+     * @return Const reference to the last element in the matrix.
+     */
+    const_reference back() const {
+        return *(end() - 1);
+    }
+
+    /**
+     * @return Const reference to the first element in the matrix.
+     */
+    const_reference front() const {
+        return *(begin());
+    }
+
+public:
+    /**
+     * @return Const iterator to the start of this matrix.
+     */
+    const_iterator begin() const {
+        return my_matrix.data.stor_begin;
+    }
+
+    /**
+     * @return Const iterator to the end of this matrix.
+     */
+    const_iterator end() const {
+        return my_matrix.data.end;
+    }
+
+    /**
+     * @return Const iterator to the start of this matrix.
+     */
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    /**
+     * @return Const iterator to the end of this matrix.
+     */
+    const_iterator cend() const {
+        return end();
+    }
+
+    /**
+     * @return Const pointer to the start of this matrix.
+     */
+    const value_type* data() const {
+        return my_matrix.data.stor_begin;
+    }
+
+    /**
+     * @return Reverse const iterator to the last element of this matrix.
+     */
+    reverse_const_iterator rbegin() const {
+        return std::reverse_iterator(end());
+    }
+
+    /**
+     * @return Reverse const iterator to a location before the start of this matrix.
+     */
+    reverse_const_iterator rend() const {
+        return std::reverse_iterator(begin());
+    }
+
+    /**
+     * @return Reverse const iterator to the last element of this matrix.
+     */
+    reverse_const_iterator crbegin() const {
+        return rbegin();
+    }
+
+    /**
+     * @return Reverse const iterator to a location before the start of this matrix.
+     */
+    reverse_const_iterator crend() const {
+        return rend();
+    }
+
+public:
+    /**
+     * @param r Row of interest.
+     * @return A const view on the row.
+     */
+    View row(size_type r) const {
+        return View(begin() + r, my_matrix.nrow, my_matrix.ncol);
+    }
+
+    /**
+     * @param c Column of interest.
+     * @return A const view on the column.
+     */
+    View column(size_type c) const {
+        return View(begin() + c * my_matrix.nrow, 1, my_matrix.nrow);
+    }
+
+    /**
+     * @param r0 First row of the block.
+     * @param c0 First column of the block.
+     * @param nr Number of rows in the block.
+     * @param nc Number of columns in the block.
+     * @return A const view on the block.
+     * An `IgraphError` is thrown if the block extends beyond the matrix.
+     */
+    Block block(size_type r0, size_type c0, size_type nr, size_type nc) const {
+        return Block(begin(), my_matrix.nrow, my_matrix.ncol, my_matrix.nrow).block(r0, c0, nr, nc);
+    }
+
+public:
+    /**
+     * @return Const pointer to the underlying **igraph** matrix object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    operator const igraph_type*() const {
+        return &my_matrix;
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** matrix object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    const igraph_type* get() const {
+        return &my_matrix;
+    }
+
+private:
+    igraph_type my_matrix;
+};
+
+/**
+ * View of a matrix of **igraph** integers.
+ */
+typedef MatrixView<matrix_internal::Integer> IntMatrixView;
+
+/**
+ * View of a matrix of **igraph** reals.
+ */
+typedef MatrixView<matrix_internal::Real> RealMatrixView;
+
+/**
+ * View of a matrix of **igraph** booleans.
+ */
+typedef MatrixView<matrix_internal::Bool> BoolMatrixView;
+
+}
+
+#endif
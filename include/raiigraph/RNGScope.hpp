@@ -4,6 +4,8 @@
 #include "igraph.h"
 #include "error.hpp"
 
+#include <cstdint>
+
 /**
  * @file RNGScope.hpp
  * @brief Control the **igraph** RNG via RAII.
@@ -11,11 +13,87 @@
 
 namespace raiigraph {
 
+/**
+ * @cond
+ */
+namespace internal {
+
+// Mixing function from SplitMix64, used to derive well-separated seeds for independent tasks from a single user-supplied seed.
+inline std::uint64_t splitmix64(std::uint64_t x) {
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+}
+/**
+ * @endcond
+ */
+
+/**
+ * @return Whether **igraph**'s default RNG is thread-local, i.e., **igraph** was compiled with thread-local storage.
+ * If true, each thread can set its own default RNG with `RNGScope` without affecting other threads.
+ * If false, there is only one default RNG for the entire process, so `RNGScope` should not be used in multiple threads at once.
+ */
+constexpr bool has_thread_local_rng() {
+#if IGRAPH_THREAD_SAFE
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Derive independent RNG streams from a single seed.
+ *
+ * This derives a separate seed for each stream from a root seed and the stream ID, using the SplitMix64 mixing function.
+ * Each task in a parallel job can then use its own stream (e.g., via `RNGScope`) with the task index as the stream ID,
+ * so that the results are reproducible regardless of the number of threads or the order in which tasks are executed.
+ */
+class RNGStreamFactory {
+public:
+    /**
+     * @param seed Root seed for all streams.
+     * @param type Pointer to the RNG type for all streams, typically `igraph_rngtype_pcg32` or `igraph_rngtype_pcg64`.
+     */
+    RNGStreamFactory(igraph_uint_t seed, const igraph_rng_type_t* type = &igraph_rngtype_pcg32) : my_seed(seed), my_type(type) {}
+
+    /**
+     * @param stream Stream ID.
+     * @return Seed for the RNG of stream `stream`.
+     */
+    igraph_uint_t seed(igraph_uint_t stream) const {
+        // Mixing the root before combining it with the stream, otherwise adjacent roots would just yield shifted streams.
+        return static_cast<igraph_uint_t>(internal::splitmix64(internal::splitmix64(static_cast<std::uint64_t>(my_seed)) ^ static_cast<std::uint64_t>(stream)));
+    }
+
+    /**
+     * @return Pointer to the RNG type.
+     */
+    const igraph_rng_type_t* type() const {
+        return my_type;
+    }
+
+    /**
+     * @return Root seed.
+     */
+    igraph_uint_t root_seed() const {
+        return my_seed;
+    }
+
+private:
+    igraph_uint_t my_seed;
+    const igraph_rng_type_t* my_type;
+};
+
 /**
  * @brief Control the **igraph** RNG via RAII.
  *
- * When an instance of this class is created, it will replace the global default **igraph** RNG with its own.
+ * When an instance of this class is created, it will replace the default **igraph** RNG with its own.
  * When it is destroyed, it will restore the default to the RNG that was present before its construction.
+ * If `has_thread_local_rng()` is true, only the default RNG of the calling thread is affected, so each worker thread can use its own instance;
+ * this is best combined with `RNGStreamFactory` to give each task its own stream.
  *
  * It is assumed that users have already called `igraph_setup()` or `initialize()` before constructing a instance of this class.
  */
@@ -46,6 +124,14 @@ public:
         previous = igraph_rng_set_default(&current);
     }
 
+    /**
+     * Sets an RNG from `factory` as the default, using the seed for the specified stream.
+     *
+     * @param factory Factory for independent RNG streams.
+     * @param stream Stream ID, e.g., the index of the current task.
+     */
+    RNGScope(const RNGStreamFactory& factory, igraph_uint_t stream) : RNGScope(factory.seed(stream), factory.type()) {}
+
     /**
      * Sets the specified RNG type as the default with its default seed.
      *
@@ -0,0 +1,598 @@
+#ifndef RAIIGRAPH_SPARSE_MATRIX_HPP
+#define RAIIGRAPH_SPARSE_MATRIX_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "Vector.hpp"
+#include "Graph.hpp"
+#include "parallelize.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+/**
+ * @file SparseMatrix.hpp
+ * @brief Sparse matrices with RAII behavior.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Wrapper around `igraph_sparsemat_t` objects with RAII behavior.
+ *
+ * This class has ownership of the underlying `igraph_sparsemat_t` object, handling both its initialization and destruction.
+ * The matrix may be in triplet form (i.e., a list of row/column/value entries) or in compressed sparse column form.
+ * Users should only pass instances of this class to **igraph** functions that accept an already-initialized sparse matrix.
+ *
+ * The internal arrays of `igraph_sparsemat_t` are not part of **igraph**'s public API.
+ * Users who need direct access to the compressed index and value arrays should convert to a `CompressedSparseMatrix`.
+ *
+ * It is assumed that users have already called `igraph_setup()` or `initialize()` before constructing a instance of this class.
+ */
+class SparseMatrix {
+private:
+    void setup(igraph_int_t nr, igraph_int_t nc, igraph_int_t nzmax) {
+        check_code(igraph_sparsemat_init(&my_sparsemat, nr, nc, nzmax));
+    }
+
+    // Moved-from matrices have NULL storage to avoid an allocation in the move constructor.
+    // We lazily re-initialize them before they are used in any igraph function.
+    igraph_sparsemat_t* restore() {
+        if (my_sparsemat.cs == NULL) {
+            setup(0, 0, 0);
+        }
+        return &my_sparsemat;
+    }
+
+    // Const access to a moved-from matrix returns this empty matrix instead, so that const methods never modify the object.
+    static const igraph_sparsemat_t* empty_placeholder() {
+        struct Holder {
+            Holder() {
+                check_code(igraph_sparsemat_init(&matrix, 0, 0, 0));
+            }
+            ~Holder() {
+                igraph_sparsemat_destroy(&matrix);
+            }
+            igraph_sparsemat_t matrix;
+        };
+        static const Holder holder;
+        return &(holder.matrix);
+    }
+
+public:
+    /**
+     * Default constructor, creates an empty matrix in triplet form with no rows or columns.
+     */
+    SparseMatrix() : SparseMatrix(0, 0) {}
+
+    /**
+     * @param nr Number of rows.
+     * @param nc Number of columns.
+     * @param nzmax Expected number of non-zero entries, to pre-allocate memory.
+     *
+     * This creates an empty matrix in triplet form.
+     */
+    SparseMatrix(igraph_int_t nr, igraph_int_t nc, igraph_int_t nzmax = 0) {
+        setup(nr, nc, nzmax);
+    }
+
+    /**
+     * @param graph The graph.
+     * @param weights Pointer to a vector of edge weights of length equal to the number of edges in `graph`.
+     * If NULL, all edges have a weight of 1.
+     * @param type Which triangles of the adjacency matrix to fill for undirected graphs.
+     * @param loops How to count self-loops on the diagonal.
+     *
+     * This creates an adjacency matrix in triplet form.
+     */
+    SparseMatrix(const Graph& graph, const igraph_vector_t* weights = NULL, igraph_get_adjacency_t type = IGRAPH_GET_ADJACENCY_BOTH, igraph_loops_t loops = IGRAPH_LOOPS_ONCE) :
+        SparseMatrix(graph.vcount(), graph.vcount(), graph.ecount())
+    {
+        check_code(igraph_get_adjacency_sparse(graph.get(), &my_sparsemat, type, weights, loops));
+    }
+
+    /**
+     * @param matrix An initialized sparse matrix to take ownership of.
+     */
+    SparseMatrix(igraph_sparsemat_t&& matrix) : my_sparsemat(std::move(matrix)) {}
+
+public:
+    /**
+     * @param other Matrix to be copy-constructed from.
+     * This constructor will make a deep copy.
+     */
+    SparseMatrix(const SparseMatrix& other) {
+        check_code(igraph_sparsemat_init_copy(&my_sparsemat, other.get()));
+    }
+
+    /**
+     * @param other Matrix to be copy-assigned from.
+     * This constructor will make a deep copy.
+     */
+    SparseMatrix& operator=(const SparseMatrix& other) {
+        if (this != &other) {
+            igraph_sparsemat_t tmp;
+            check_code(igraph_sparsemat_init_copy(&tmp, other.get()));
+            if (my_sparsemat.cs != NULL) {
+                igraph_sparsemat_destroy(&my_sparsemat);
+            }
+            my_sparsemat = tmp;
+        }
+        return *this;
+    }
+
+    /**
+     * @param other Matrix to be move-constructed from.
+     * This constructor does not allocate and will leave `other` as an empty matrix with no rows or columns.
+     * Any subsequent use of `other` in an **igraph** function (e.g., via `get()`) will re-initialize it.
+     */
+    SparseMatrix(SparseMatrix&& other) noexcept : my_sparsemat(other.my_sparsemat) {
+        other.my_sparsemat.cs = NULL;
+    }
+
+    /**
+     * @param other Matrix to be move-assigned from.
+     * This constructor will leave `other` in a valid but unspecified state.
+     */
+    SparseMatrix& operator=(SparseMatrix&& other) noexcept {
+        if (this != &other) {
+            std::swap(my_sparsemat, other.my_sparsemat);
+        }
+        return *this;
+    }
+
+    /**
+     * Destructor.
+     */
+    ~SparseMatrix() {
+        if (my_sparsemat.cs != NULL) {
+            igraph_sparsemat_destroy(&my_sparsemat);
+        }
+    }
+
+public:
+    /**
+     * @return Number of rows.
+     */
+    igraph_int_t nrow() const {
+        return igraph_sparsemat_nrow(get());
+    }
+
+    /**
+     * @return Number of columns.
+     */
+    igraph_int_t ncol() const {
+        return igraph_sparsemat_ncol(get());
+    }
+
+    /**
+     * @return Whether the matrix is in triplet form.
+     */
+    bool is_triplet() const {
+        return igraph_sparsemat_is_triplet(get());
+    }
+
+    /**
+     * @return Whether the matrix is in compressed sparse column form.
+     */
+    bool is_compressed() const {
+        return igraph_sparsemat_is_cc(get());
+    }
+
+    /**
+     * @return Number of stored entries, including explicit zeros and (for triplet form) duplicates.
+     */
+    igraph_int_t nonzero_storage() const {
+        return igraph_sparsemat_nonzero_storage(get());
+    }
+
+    /**
+     * Add an entry to a matrix in triplet form.
+     * Duplicate entries are summed when the matrix is compressed.
+     *
+     * @param r Row index.
+     * @param c Column index.
+     * @param value Value of the entry.
+     */
+    void add_entry(igraph_int_t r, igraph_int_t c, igraph_real_t value) {
+        check_code(igraph_sparsemat_entry(restore(), r, c, value));
+    }
+
+    /**
+     * @return A copy of this matrix in compressed sparse column form.
+     * This matrix should be in triplet form.
+     */
+    SparseMatrix compress() const {
+        igraph_sparsemat_t output;
+        check_code(igraph_sparsemat_compress(get(), &output));
+        return SparseMatrix(std::move(output));
+    }
+
+public:
+    /**
+     * @return Pointer to the underlying **igraph** sparse matrix object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    operator igraph_sparsemat_t*() {
+        return restore();
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** sparse matrix object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    operator const igraph_sparsemat_t*() const {
+        return get();
+    }
+
+    /**
+     * @return Pointer to the underlying **igraph** sparse matrix object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    igraph_sparsemat_t* get() {
+        return restore();
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** sparse matrix object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    const igraph_sparsemat_t* get() const {
+        if (my_sparsemat.cs == NULL) {
+            return empty_placeholder();
+        }
+        return &my_sparsemat;
+    }
+
+private:
+    igraph_sparsemat_t my_sparsemat;
+};
+
+/**
+ * @brief Compressed sparse matrix with directly accessible arrays.
+ *
+ * This stores a sparse matrix of real values in compressed sparse row (CSR) or column (CSC) form.
+ * Unlike `SparseMatrix`, the pointer, index and value arrays are owned by **raiigraph** and can be accessed without copying,
+ * e.g., to pass to external linear algebra libraries.
+ * Within each row (for CSR) or column (for CSC), indices are sorted and unique.
+ */
+class CompressedSparseMatrix {
+public:
+    /**
+     * Default constructor, creates a CSR matrix with no rows or columns.
+     */
+    CompressedSparseMatrix() : my_pointers(1) {}
+
+    /**
+     * @param nr Number of rows.
+     * @param nc Number of columns.
+     * @param pointers Vector of pointers, of length equal to `nr + 1` (for `by_row = true`) or `nc + 1` (otherwise).
+     * @param indices Vector of column indices (for `by_row = true`) or row indices (otherwise) for each non-zero entry.
+     * These should be sorted and unique within each row/column.
+     * @param values Vector of values for each non-zero entry.
+     * @param by_row Whether the matrix is stored in CSR form.
+     *
+     * An `IgraphError` is thrown if the array lengths are inconsistent, if `pointers` is decreasing,
+     * or if any index is out of range or not strictly increasing within its row/column.
+     */
+    CompressedSparseMatrix(igraph_int_t nr, igraph_int_t nc, IntVector pointers, IntVector indices, RealVector values, bool by_row) :
+        my_nrow(nr), my_ncol(nc), my_by_row(by_row), my_pointers(std::move(pointers)), my_indices(std::move(indices)), my_values(std::move(values))
+    {
+        if (nr < 0 || nc < 0 || my_pointers.size() != (by_row ? nr : nc) + 1 || my_pointers.front() != 0 || my_pointers.back() != my_indices.size() || my_indices.size() != my_values.size()) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+
+        // Validating the structure, as the other methods index directly into the arrays.
+        igraph_int_t nmajor = (by_row ? nr : nc);
+        igraph_int_t nminor = (by_row ? nc : nr);
+        for (igraph_int_t m = 0; m < nmajor; ++m) {
+            auto start = my_pointers[m], end = my_pointers[m + 1];
+            if (end < start) {
+                throw IgraphError(IGRAPH_EINVAL);
+            }
+            for (auto i = start; i < end; ++i) {
+                auto current = my_indices[i];
+                if (current < 0 || current >= nminor || (i > start && current <= my_indices[i - 1])) {
+                    throw IgraphError(IGRAPH_EINVAL);
+                }
+            }
+        }
+    }
+
+    /**
+     * Create an adjacency matrix directly from a graph, in time proportional to the number of edges.
+     * For directed graphs, the entry at `(i, j)` is the total weight of all edges from `i` to `j`.
+     * For undirected graphs, the matrix is symmetric and includes both triangles.
+     *
+     * @param graph The graph.
+     * @param weights Pointer to a vector of edge weights of length equal to the number of edges in `graph`.
+     * If NULL, all edges have a weight of 1.
+     * @param by_row Whether to store the matrix in CSR form.
+     * @param loops How to count self-loops in undirected graphs, either not at all (`IGRAPH_NO_LOOPS`), once (`IGRAPH_LOOPS_ONCE`) or twice (`IGRAPH_LOOPS_TWICE`).
+     * For directed graphs, self-loops are always counted once unless `IGRAPH_NO_LOOPS` is specified.
+     */
+    CompressedSparseMatrix(const Graph& graph, const igraph_vector_t* weights = NULL, bool by_row = true, igraph_loops_t loops = IGRAPH_LOOPS_ONCE) :
+        my_nrow(graph.vcount()), my_ncol(graph.vcount()), my_by_row(by_row)
+    {
+        auto ptr = graph.get();
+        igraph_int_t nedges = graph.ecount();
+        if (weights != NULL && igraph_vector_size(weights) != nedges) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+
+        bool directed = graph.is_directed();
+        const igraph_int_t* from = ptr->from.stor_begin;
+        const igraph_int_t* to = ptr->to.stor_begin;
+        const igraph_real_t* wptr = (weights == NULL ? NULL : weights->stor_begin);
+        double loop_multiplier = (!directed && loops == IGRAPH_LOOPS_TWICE ? 2 : 1);
+
+        std::vector<igraph_int_t> triplet_major, triplet_minor;
+        std::vector<igraph_real_t> triplet_values;
+        auto reserved = static_cast<std::size_t>(directed ? nedges : nedges * 2);
+        triplet_major.reserve(reserved);
+        triplet_minor.reserve(reserved);
+        triplet_values.reserve(reserved);
+
+        for (igraph_int_t e = 0; e < nedges; ++e) {
+            auto f = from[e], t = to[e];
+            double w = (wptr == NULL ? 1 : wptr[e]);
+            if (f == t) {
+                if (loops != IGRAPH_NO_LOOPS) {
+                    triplet_major.push_back(f);
+                    triplet_minor.push_back(f);
+                    triplet_values.push_back(w * loop_multiplier);
+                }
+                continue;
+            }
+
+            if (directed) {
+                triplet_major.push_back(by_row ? f : t);
+                triplet_minor.push_back(by_row ? t : f);
+                triplet_values.push_back(w);
+            } else {
+                triplet_major.push_back(f);
+                triplet_minor.push_back(t);
+                triplet_values.push_back(w);
+                triplet_major.push_back(t);
+                triplet_minor.push_back(f);
+                triplet_values.push_back(w);
+            }
+        }
+
+        fill(triplet_major, triplet_minor, triplet_values);
+    }
+
+    /**
+     * @param matrix An **igraph** sparse matrix, in triplet or compressed form.
+     * Duplicate entries are summed.
+     * @param by_row Whether to store the matrix in CSR form.
+     */
+    CompressedSparseMatrix(const SparseMatrix& matrix, bool by_row = true) : my_nrow(matrix.nrow()), my_ncol(matrix.ncol()), my_by_row(by_row) {
+        IntVector rows, cols;
+        RealVector vals;
+        check_code(igraph_sparsemat_getelements_sorted(matrix.get(), rows.get(), cols.get(), vals.get()));
+        if (by_row) {
+            fill(rows, cols, vals);
+        } else {
+            fill(cols, rows, vals);
+        }
+    }
+
+private:
+    // Counting sort on the major index, followed by sorting and merging of duplicates within each major index.
+    template<class Major_, class Minor_, class Values_>
+    void fill(const Major_& major, const Minor_& minor, const Values_& values) {
+        igraph_int_t nmajor = (my_by_row ? my_nrow : my_ncol);
+        igraph_int_t nminor = (my_by_row ? my_ncol : my_nrow);
+        std::size_t nentries = major.size();
+
+        my_pointers.resize(nmajor + 1);
+        std::fill(my_pointers.begin(), my_pointers.end(), 0);
+        for (std::size_t i = 0; i < nentries; ++i) {
+            auto m = major[i];
+            if (m < 0 || m >= nmajor || minor[i] < 0 || minor[i] >= nminor) {
+                throw IgraphError(IGRAPH_EINVAL);
+            }
+            ++my_pointers[m + 1];
+        }
+        std::partial_sum(my_pointers.begin(), my_pointers.end(), my_pointers.begin());
+
+        std::vector<std::pair<igraph_int_t, igraph_real_t> > scratch(nentries);
+        {
+            std::vector<igraph_int_t> offsets(my_pointers.begin(), my_pointers.end() - 1);
+            for (std::size_t i = 0; i < nentries; ++i) {
+                auto& current = offsets[major[i]];
+                scratch[current] = std::make_pair(minor[i], values[i]);
+                ++current;
+            }
+        }
+
+        my_indices.resize_uninitialized(nentries);
+        my_values.resize_uninitialized(nentries);
+        igraph_int_t counter = 0;
+        for (igraph_int_t m = 0; m < nmajor; ++m) {
+            auto start = scratch.begin() + my_pointers[m], end = scratch.begin() + my_pointers[m + 1];
+            std::sort(start, end, [](const auto& left, const auto& right) -> bool { return left.first < right.first; });
+
+            my_pointers[m] = counter;
+            for (; start != end; ++start) {
+                if (counter > my_pointers[m] && my_indices[counter - 1] == start->first) {
+                    my_values[counter - 1] += start->second;
+                } else {
+                    my_indices[counter] = start->first;
+                    my_values[counter] = start->second;
+                    ++counter;
+                }
+            }
+        }
+
+        my_pointers.back() = counter;
+        my_indices.resize(counter);
+        my_values.resize(counter);
+    }
+
+public:
+    /**
+     * @return Number of rows.
+     */
+    igraph_int_t nrow() const {
+        return my_nrow;
+    }
+
+    /**
+     * @return Number of columns.
+     */
+    igraph_int_t ncol() const {
+        return my_ncol;
+    }
+
+    /**
+     * @return Whether the matrix is stored in CSR form.
+     * If false, it is stored in CSC form.
+     */
+    bool by_row() const {
+        return my_by_row;
+    }
+
+    /**
+     * @return Number of non-zero entries.
+     */
+    igraph_int_t nonzeros() const {
+        return my_indices.size();
+    }
+
+    /**
+     * @return Vector of pointers.
+     * For CSR matrices, the entries of row `r` are stored at positions `[pointers()[r], pointers()[r + 1])` of `indices()` and `values()`.
+     * For CSC matrices, the same applies to columns instead.
+     */
+    const IntVector& pointers() const {
+        return my_pointers;
+    }
+
+    /**
+     * @return Vector of column indices (for CSR) or row indices (for CSC) for each non-zero entry.
+     */
+    const IntVector& indices() const {
+        return my_indices;
+    }
+
+    /**
+     * @return Vector of values for each non-zero entry.
+     */
+    const RealVector& values() const {
+        return my_values;
+    }
+
+    /**
+     * Release ownership of the pointer, index and value arrays to the caller, without copying their contents.
+     * This matrix is subsequently left with no rows or columns.
+     *
+     * @return Tuple containing the pointers, indices and values.
+     */
+    std::tuple<IntVector, IntVector, RealVector> release() {
+        std::tuple<IntVector, IntVector, RealVector> output(std::move(my_pointers), std::move(my_indices), std::move(my_values));
+        my_nrow = 0;
+        my_ncol = 0;
+        my_pointers = IntVector(1);
+        return output;
+    }
+
+    /**
+     * @return An **igraph** sparse matrix in compressed sparse column form, containing a copy of this matrix.
+     */
+    SparseMatrix to_sparsemat() const {
+        SparseMatrix triplets(my_nrow, my_ncol, nonzeros());
+        igraph_int_t nmajor = my_pointers.size() - 1;
+        for (igraph_int_t m = 0; m < nmajor; ++m) {
+            for (igraph_int_t i = my_pointers[m], end = my_pointers[m + 1]; i < end; ++i) {
+                if (my_by_row) {
+                    triplets.add_entry(m, my_indices[i], my_values[i]);
+                } else {
+                    triplets.add_entry(my_indices[i], m, my_values[i]);
+                }
+            }
+        }
+        return triplets.compress();
+    }
+
+public:
+    /**
+     * Compute the product of this matrix with a dense vector, i.e., `y = A * x`.
+     * For CSR matrices, each thread computes a contiguous block of rows of `y`.
+     * For CSC matrices, each thread computes a partial product from a contiguous block of columns, which are then summed;
+     * this requires an extra `num_threads * nrow()` doubles, so CSR is preferred for multi-threaded use.
+     *
+     * @tparam Input_ Contiguous container of `igraph_real_t` that provides the `data()` and `size()` methods, e.g., `RealVector`, `RealVectorView`, `std::vector`.
+     * @param x The dense vector, of length equal to `ncol()`.
+     * @param[out] y Vector to store the output.
+     * On output, this is resized to `nrow()` and filled with the product.
+     * This should not refer to the same memory as `x`.
+     * @param num_threads Number of threads to use.
+     */
+    template<class Input_>
+    void multiply(const Input_& x, RealVector& y, int num_threads = 1) const {
+        if (static_cast<igraph_int_t>(x.size()) != my_ncol) {
+            throw IgraphError(IGRAPH_EINVAL);
+        }
+        const igraph_real_t* xptr = x.data();
+        y.resize_uninitialized(my_nrow);
+        igraph_real_t* yptr = y.data();
+
+        const igraph_int_t* pptr = my_pointers.data();
+        const igraph_int_t* iptr = my_indices.data();
+        const igraph_real_t* vptr = my_values.data();
+
+        if (my_by_row) {
+            parallelize(num_threads, my_nrow, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+                for (igraph_int_t r = start, end = start + length; r < end; ++r) {
+                    igraph_real_t sum = 0;
+                    for (igraph_int_t i = pptr[r], iend = pptr[r + 1]; i < iend; ++i) {
+                        sum += vptr[i] * xptr[iptr[i]];
+                    }
+                    yptr[r] = sum;
+                }
+            });
+            return;
+        }
+
+        std::fill_n(yptr, my_nrow, 0);
+        std::vector<std::vector<igraph_real_t> > partials(std::max(num_threads, 1) - 1);
+        parallelize(num_threads, my_ncol, [&](int t, igraph_int_t start, igraph_int_t length) -> void {
+            igraph_real_t* out = yptr;
+            if (t > 0) { // first thread writes directly to the output.
+                auto& buffer = partials[t - 1];
+                buffer.resize(my_nrow);
+                out = buffer.data();
+            }
+            for (igraph_int_t c = start, end = start + length; c < end; ++c) {
+                auto mult = xptr[c];
+                for (igraph_int_t i = pptr[c], iend = pptr[c + 1]; i < iend; ++i) {
+                    out[iptr[i]] += vptr[i] * mult;
+                }
+            }
+        });
+
+        for (const auto& p : partials) {
+            if (!p.empty()) {
+                for (igraph_int_t r = 0; r < my_nrow; ++r) {
+                    yptr[r] += p[r];
+                }
+            }
+        }
+    }
+
+private:
+    igraph_int_t my_nrow = 0, my_ncol = 0;
+    bool my_by_row = true;
+    IntVector my_pointers;
+    IntVector my_indices;
+    RealVector my_values;
+};
+
+}
+
+#endif
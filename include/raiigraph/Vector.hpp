@@ -7,6 +7,12 @@
 #include <algorithm>
 #include <initializer_list>
 #include <iterator>
+#include <limits>
+#include <type_traits>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <cstring>
 
 /**
  * @file Vector.hpp
@@ -15,6 +21,72 @@
 
 namespace raiigraph {
 
+/**
+ * @brief Tag to request uninitialized contents.
+ *
+ * This can be passed to the constructors of `Vector` and `Matrix` to skip the initialization of the allocated memory,
+ * which is useful when the caller will immediately overwrite all values.
+ */
+struct UninitializedTag {};
+
+/**
+ * Instance of `UninitializedTag` for convenience.
+ */
+inline constexpr UninitializedTag uninitialized{};
+
+/**
+ * @brief Deleter for memory allocated by **igraph**.
+ */
+struct IgraphDeleter {
+    /**
+     * @param ptr Pointer to memory allocated by **igraph**, to be released with `igraph_free()`.
+     */
+    void operator()(void* ptr) const {
+        igraph_free(ptr);
+    }
+};
+
+/**
+ * Smart pointer to an array that was allocated by **igraph**.
+ * @tparam Type_ Type of the array elements.
+ */
+template<typename Type_>
+using IgraphPointer = std::unique_ptr<Type_[], IgraphDeleter>;
+
+/**
+ * @cond
+ */
+namespace internal {
+
+// Allocates the storage for an igraph_vector_*_t without zeroing it, unlike igraph_vector_*_init().
+// This uses igraph_malloc() so that the storage can be managed by igraph functions afterwards.
+template<class IgraphVector_>
+void allocate_uninitialized(IgraphVector_& vector, igraph_int_t size) {
+    typedef typename std::remove_pointer<decltype(vector.stor_begin)>::type Value_;
+    if (size < 0) {
+        throw IgraphError(IGRAPH_EINVAL);
+    }
+
+    igraph_int_t alloc = (size > 0 ? size : 1); // igraph always allocates at least one element.
+    if (static_cast<std::size_t>(alloc) > std::numeric_limits<std::size_t>::max() / sizeof(Value_)) {
+        throw IgraphError(IGRAPH_EOVERFLOW);
+    }
+
+    auto ptr = static_cast<Value_*>(igraph_malloc(sizeof(Value_) * static_cast<std::size_t>(alloc)));
+    if (ptr == NULL) {
+        throw IgraphError(IGRAPH_ENOMEM);
+    }
+
+    vector.stor_begin = ptr;
+    vector.stor_end = ptr + alloc;
+    vector.end = ptr + size;
+}
+
+}
+/**
+ * @endcond
+ */
+
 /**
  * @brief Wrapper around `igraph_vector_*_t` objects with RAII behavior.
  * @tparam Ns_ Structure-based namespace with static methods, internal use only.
@@ -32,6 +104,52 @@ private:
         check_code(Ns_::init(&my_vector, size));
     }
 
+    // Moved-from vectors have NULL storage to avoid an allocation in the move constructor.
+    // We lazily re-initialize them before they are used in any igraph function.
+    typename Ns_::igraph_type* restore() {
+        if (my_vector.stor_begin == NULL) {
+            setup(0);
+        }
+        return &my_vector;
+    }
+
+    // Const access to a moved-from vector returns this empty vector instead, so that const methods never modify the object.
+    static const typename Ns_::igraph_type* empty_placeholder() {
+        static const typename Ns_::value_type dummy{}; // igraph asserts that the storage is non-NULL, even for empty vectors.
+        static const typename Ns_::igraph_type empty = Ns_::view(&dummy, 0);
+        return &empty;
+    }
+
+    void release_storage() noexcept {
+        my_vector.stor_begin = NULL;
+        my_vector.stor_end = NULL;
+        my_vector.end = NULL;
+    }
+
+    // Growing the capacity geometrically, so that repeated insertions take amortized constant time per element.
+    // In contrast, igraph_vector_*_resize() only reserves the exact size.
+    void reserve_geometric(igraph_int_t new_size) {
+        igraph_int_t old_capacity = my_vector.stor_end - my_vector.stor_begin;
+        if (new_size > old_capacity) {
+            igraph_int_t target = new_size;
+            if (old_capacity <= IGRAPH_INTEGER_MAX / 2) {
+                target = std::max(target, old_capacity * 2);
+            }
+            check_code(Ns_::reserve(restore(), target));
+        }
+    }
+
+    // Opening a gap of 'n' elements at 'delta', returning a pointer to the start of the gap.
+    // The values are all trivially copyable, so we can use memmove() to shift the existing elements.
+    typename Ns_::value_type* make_gap(igraph_int_t delta, igraph_int_t n) {
+        igraph_int_t old_size = my_vector.end - my_vector.stor_begin;
+        reserve_geometric(old_size + n);
+        check_code(Ns_::resize(restore(), old_size + n)); // no reallocation is required here.
+        auto start = my_vector.stor_begin + delta;
+        std::memmove(start + n, start, sizeof(*start) * static_cast<std::size_t>(old_size - delta));
+        return start;
+    }
+
 public:
     /**
      * Type of the underlying **igraph** vector.
@@ -94,10 +212,19 @@ public:
      * @param val Value to use to fill the vector.
      */
     Vector(size_type size, const value_type& val = value_type()) {
-        setup(size);
+        internal::allocate_uninitialized(my_vector, size); // avoid zeroing the memory before filling it.
         std::fill_n(begin(), size, val);
     }
 
+    /**
+     * @param size Size of the vector to create.
+     * @param tag Tag to indicate that the vector contents should not be initialized.
+     * All values are unspecified until they are explicitly set by the caller.
+     */
+    Vector(size_type size, [[maybe_unused]] UninitializedTag tag) {
+        internal::allocate_uninitialized(my_vector, size);
+    }
+
     /**
      * @param vector An initialized vector to take ownership of.
      */
@@ -109,7 +236,7 @@ public:
      * @param last Iterator to the end of a range (i.e., past the final element in the range).
      */
     template<typename InputIterator, typename = decltype(*std::declval<InputIterator>())> // use SFINAE to avoid ambiguity with other 2-argument constructors.
-    Vector(InputIterator first, InputIterator last) : Vector(last - first) {
+    Vector(InputIterator first, InputIterator last) : Vector(last - first, uninitialized) {
         std::copy(first, last, begin());
     }
 
@@ -119,7 +246,7 @@ public:
      * This constructor will make a deep copy.
      */
     Vector(const Vector<Ns_>& other) {
-        check_code(Ns_::copy(&my_vector, &(other.my_vector)));
+        check_code(Ns_::copy(&my_vector, other.get()));
     }
 
     /**
@@ -128,28 +255,31 @@ public:
      */
     Vector<Ns_>& operator=(const Vector<Ns_>& other) {
         if (this != &other) {
-            // my_vector should already be initialized before the assignment.
-            check_code(Ns_::update(&my_vector, &(other.my_vector)));
+            if (my_vector.stor_begin == NULL) {
+                check_code(Ns_::copy(&my_vector, other.get()));
+            } else {
+                check_code(Ns_::update(&my_vector, other.get()));
+            }
         }
         return *this;
     }
 
     /**
      * @param other Vector to be move-constructed from.
-     * This constructor will leave `other` in a valid but unspecified state.
+     * This constructor does not allocate and will leave `other` as an empty vector.
+     * Any subsequent use of `other` in an **igraph** function (e.g., via `get()`) will re-initialize it.
      */
-    Vector(Vector<Ns_>&& other) {
-        setup(0); // we must leave 'other' in a valid state.
-        std::swap(my_vector, other.my_vector);
+    Vector(Vector<Ns_>&& other) noexcept : my_vector(other.my_vector) {
+        other.release_storage();
     }
 
     /**
      * @param other Vector to be move-assigned from.
      * This constructor will leave `other` in a valid but unspecified state.
      */
-    Vector& operator=(Vector<Ns_>&& other) {
+    Vector& operator=(Vector<Ns_>&& other) noexcept {
         if (this != &other) {
-            std::swap(my_vector, other.my_vector); // 'my_vector' should already be initialized, so we're leaving 'other' in a valid state.
+            std::swap(my_vector, other.my_vector); // 'other' gets our storage, which is either initialized or lazily restored on use.
         }
         return *this;
     }
@@ -158,7 +288,9 @@ public:
      * Destructor.
      */
     ~Vector() {
-        Ns_::destroy(&my_vector);
+        if (my_vector.stor_begin != NULL) {
+            Ns_::destroy(&my_vector);
+        }
     }
 
 public:
@@ -166,14 +298,14 @@ public:
      * @return Whether the vector is empty.
      */
     igraph_bool_t empty() const {
-        return Ns_::empty(&my_vector);
+        return my_vector.end == my_vector.stor_begin;
     }
 
     /**
      * @return Size of the vector.
      */
     size_type size() const {
-        return Ns_::size(&my_vector);
+        return my_vector.end - my_vector.stor_begin;
     }
 
     /**
@@ -192,7 +324,7 @@ public:
      * Clear this vector, leaving it with a size of zero.
      */
     void clear() {
-        Ns_::clear(&my_vector);
+        my_vector.end = my_vector.stor_begin;
     }
 
     /**
@@ -202,25 +334,35 @@ public:
      */
     void resize(size_type size, value_type val = value_type()) {
         auto old_size = this->size();
-        check_code(Ns_::resize(&my_vector, size));
+        check_code(Ns_::resize(restore(), size));
         if (old_size < size) {
             std::fill_n(begin() + old_size, size - old_size, val);
         }
     }
 
+    /**
+     * Resize the vector to the specified `size`, without initializing any new elements.
+     * This is more efficient than `resize()` when the caller will immediately overwrite the new elements.
+     * @param size New size of the vector.
+     * If this is greater than the current size, the values of the new elements are unspecified.
+     */
+    void resize_uninitialized(size_type size) {
+        check_code(Ns_::resize(restore(), size));
+    }
+
     /**
      * Reserve the capacity of the vector.
      * @param capacity Capacity of the vector.
      */
     void reserve(size_type capacity) {
-        check_code(Ns_::reserve(&my_vector, capacity));
+        check_code(Ns_::reserve(restore(), capacity));
     }
 
     /**
      * Shrink the capacity of the vector to fit the contents.
      */
     void shrink_to_fit() {
-        Ns_::shrink_to_fit(&my_vector);
+        Ns_::shrink_to_fit(restore());
     }
 
     /**
@@ -228,7 +370,7 @@ public:
      * @param val Value to be added.
      */
     void push_back(value_type val) {
-        check_code(Ns_::push_back(&my_vector, val));
+        check_code(Ns_::push_back(restore(), val));
     }
 
     /**
@@ -253,7 +395,7 @@ public:
      * @param pos Position at which to erase the element.
      */
     iterator erase(iterator pos) {
-        Ns_::remove(&my_vector, pos - begin());
+        Ns_::remove(restore(), pos - begin());
         return pos;
     }
 
@@ -264,7 +406,7 @@ public:
      */
     iterator erase(iterator first, iterator last) {
         auto start = begin();
-        Ns_::remove_section(&my_vector, first - start, last - start);
+        Ns_::remove_section(restore(), first - start, last - start);
         return first;
     }
 
@@ -275,9 +417,9 @@ public:
      * @return Iterator to the newly inserted element.
      */
     iterator insert(iterator pos, value_type val) {
-        auto delta = pos - begin();
-        check_code(Ns_::insert(&my_vector, delta, val));
-        return begin() + delta; // recompute it as there might be a reallocation.
+        auto start = make_gap(pos - begin(), 1);
+        *start = val;
+        return start;
     }
 
     /**
@@ -300,12 +442,7 @@ public:
      * @return Iterator to the first newly inserted element.
      */
     iterator insert(iterator pos, size_type n, value_type val) {
-        auto delta = pos - begin();
-        auto old_size = size();
-        resize(old_size + n);
-
-        auto new_start = begin() + delta; // recompute it as there might be a reallocation.
-        std::copy(new_start, begin() + old_size, new_start + n);
+        auto new_start = make_gap(pos - begin(), n);
         std::fill_n(new_start, n, val);
         return new_start; 
     }
@@ -315,22 +452,60 @@ public:
      * @tparam InputIterator Iterator type that supports forward increments and subtraction.
      * @param pos Position at which to insert the new elements.
      * @param first Iterator to the start of a range.
+     * This should not refer to elements of this vector.
      * @param last Iterator to the end of a range (i.e., past the final element in the range).
      * @return Iterator to the first newly inserted element.
      */
     template<typename InputIterator, typename = decltype(*std::declval<InputIterator>())>
     iterator insert(iterator pos, InputIterator first, InputIterator last) {
-        auto delta = pos - begin();
-        auto old_size = size();
-        auto n = last - first;
-        resize(old_size + n);
-
-        auto new_start = begin() + delta; // recompute it as there might be a reallocation.
-        std::copy(new_start, begin() + old_size, new_start + n);
+        auto new_start = make_gap(pos - begin(), last - first);
         std::copy(first, last, new_start);
         return new_start; 
     }
 
+    /**
+     * Append a sequence of elements to the end of the vector.
+     * The capacity is increased geometrically so that repeated appends take amortized constant time per element.
+     * @tparam Range_ Range that supports `std::begin()` and `std::end()`, where the difference between iterators is the range length.
+     * @param range Range of values to append.
+     * This should not refer to elements of this vector.
+     */
+    template<class Range_>
+    void append_range(const Range_& range) {
+        insert(end(), std::begin(range), std::end(range));
+    }
+
+    /**
+     * Replace the contents of the vector with a sequence of elements.
+     * Existing capacity is re-used where possible.
+     * @tparam Range_ Range that supports `std::begin()` and `std::end()`, where the difference between iterators is the range length.
+     * @param range Range of values to assign.
+     * This should not refer to elements of this vector.
+     */
+    template<class Range_>
+    void assign_range(const Range_& range) {
+        auto first = std::begin(range);
+        auto last = std::end(range);
+        size_type n = last - first;
+        reserve_geometric(n);
+        resize_uninitialized(n);
+        std::copy(first, last, begin());
+    }
+
+    /**
+     * Release ownership of the underlying array to the caller, without copying its contents.
+     * This vector is subsequently left empty, as if it were moved from.
+     *
+     * @return Pair containing a pointer to the array and the number of elements in the array.
+     * The array is freed by `igraph_free()` when the pointer goes out of scope.
+     */
+    std::pair<IgraphPointer<value_type>, size_type> release() {
+        auto size = this->size();
+        IgraphPointer<value_type> output(my_vector.stor_begin);
+        release_storage();
+        return std::make_pair(std::move(output), size);
+    }
+
 public:
     /**
      * @param i Index on the vector.
@@ -481,7 +656,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     operator igraph_type*() {
-        return &my_vector;
+        return restore();
     }
 
     /**
@@ -489,7 +664,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     operator const igraph_type*() const {
-        return &my_vector;
+        return get();
     }
 
     /**
@@ -497,7 +672,7 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     igraph_type* get() {
-        return &my_vector;
+        return restore();
     }
 
     /**
@@ -505,6 +680,9 @@ public:
      * This is guaranteed to be non-NULL and initialized.
      */
     const igraph_type* get() const {
+        if (my_vector.stor_begin == NULL) {
+            return empty_placeholder();
+        }
         return &my_vector;
     }
 
@@ -513,7 +691,7 @@ public:
      * Swap two vectors, maintaining the validity of existing pointers to each vector and its elements.
      * @param other Vector to be swapped.
      */
-    void swap(Vector<Ns_>& other)  {
+    void swap(Vector<Ns_>& other) noexcept {
         // Swapping structures entirely to ensure that iterators and pointers
         // remain valid; looks like igraph_vector_swap does the same.
         std::swap(my_vector, other.my_vector);
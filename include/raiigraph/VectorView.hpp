@@ -0,0 +1,242 @@
+#ifndef RAIIGRAPH_VECTOR_VIEW_HPP
+#define RAIIGRAPH_VECTOR_VIEW_HPP
+
+#include "igraph.h"
+#include "Vector.hpp"
+
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @file VectorView.hpp
+ * @brief Read-only view of external memory as an `igraph_vector_*_t`.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Read-only view of external memory as an `igraph_vector_*_t`.
+ * @tparam Ns_ Structure-based namespace with static methods, internal use only.
+ *
+ * This class wraps an existing array (e.g., from a `std::vector` or a `Vector`) without copying its contents.
+ * It provides the same STL-like accessors as `Vector` and can be passed directly to **igraph** functions that accept a const pointer to a vector.
+ * The view does not own the underlying array, so users should ensure that the array outlives the view and is not reallocated while the view is in use.
+ */
+template<class Ns_>
+class VectorView {
+public:
+    /**
+     * Type of the underlying **igraph** vector.
+     */
+    typedef typename Ns_::igraph_type igraph_type;
+
+    /**
+     * Type of the values inside the vector.
+     */
+    typedef typename Ns_::value_type value_type;
+
+    /**
+     * Type of a const reference to values inside the vector.
+     */
+    typedef const value_type& const_reference;
+
+    /**
+     * Type of the reference to values inside the vector.
+     * This is the same as `const_reference` as views are read-only.
+     */
+    typedef const_reference reference;
+
+    /**
+     * Integer type for the size of the vector.
+     */
+    typedef igraph_int_t size_type;
+
+    /**
+     * Integer type for differences in positions within the vector.
+     */
+    typedef igraph_int_t difference_type;
+
+    /**
+     * Const iterator for the vector contents.
+     */
+    typedef const value_type* const_iterator;
+
+    /**
+     * Iterator for the vector contents.
+     * This is the same as `const_iterator` as views are read-only.
+     */
+    typedef const_iterator iterator;
+
+    /**
+     * Reverse const iterator for the vector contents.
+     */
+    typedef std::reverse_iterator<const_iterator> reverse_const_iterator;
+
+private:
+    static const value_type* placeholder() {
+        // igraph asserts that the storage is non-NULL, even for empty vectors.
+        static const value_type dummy{};
+        return &dummy;
+    }
+
+public:
+    /**
+     * Default constructor, creates a view of length zero.
+     */
+    VectorView() : VectorView(NULL, 0) {}
+
+    /**
+     * @param data Pointer to the start of an array.
+     * This may be NULL if `size = 0`.
+     * @param size Length of the array.
+     */
+    VectorView(const value_type* data, size_type size) : my_vector(Ns_::view(data == NULL ? placeholder() : data, size)) {}
+
+    /**
+     * @tparam Container_ Contiguous container that provides the `data()` and `size()` methods, e.g., `std::vector`, `Vector`.
+     * @param container Instance of a contiguous container.
+     */
+    template<class Container_, typename = typename std::enable_if<std::is_convertible<decltype(std::declval<const Container_&>().data()), const value_type*>::value>::type>
+    VectorView(const Container_& container) : VectorView(container.data(), static_cast<size_type>(container.size())) {}
+
+public:
+    /**
+     * @return Whether the view is empty.
+     */
+    bool empty() const {
+        return my_vector.end == my_vector.stor_begin;
+    }
+
+    /**
+     * @return Length of the view.
+     */
+    size_type size() const {
+        return my_vector.end - my_vector.stor_begin;
+    }
+
+    /**
+     * @param i Index on the view.
+     * @return Const reference to the value at `i`.
+     */
+    const_reference operator[](size_type i) const {
+        return *(begin() + i);
+    }
+
+    /**
+     * @return Const reference to the last element in the view.
+     */
+    const_reference back() const {
+        return *(end() - 1);
+    }
+
+    /**
+     * @return Const reference to the first element in the view.
+     */
+    const_reference front() const {
+        return *(begin());
+    }
+
+public:
+    /**
+     * @return Const iterator to the start of this view.
+     */
+    const_iterator begin() const {
+        return my_vector.stor_begin;
+    }
+
+    /**
+     * @return Const iterator to the end of this view.
+     */
+    const_iterator end() const {
+        return my_vector.end;
+    }
+
+    /**
+     * @return Const iterator to the start of this view.
+     */
+    const_iterator cbegin() const {
+        return begin();
+    }
+
+    /**
+     * @return Const iterator to the end of this view.
+     */
+    const_iterator cend() const {
+        return end();
+    }
+
+    /**
+     * @return Const pointer to the start of this view.
+     */
+    const value_type* data() const {
+        return my_vector.stor_begin;
+    }
+
+    /**
+     * @return Reverse const iterator to the last element of this view.
+     */
+    reverse_const_iterator rbegin() const {
+        return std::reverse_iterator(end());
+    }
+
+    /**
+     * @return Reverse const iterator to a location before the start of this view.
+     */
+    reverse_const_iterator rend() const {
+        return std::reverse_iterator(begin());
+    }
+
+    /**
+     * @return Reverse const iterator to the last element of this view.
+     */
+    reverse_const_iterator crbegin() const {
+        return rbegin();
+    }
+
+    /**
+     * @return Reverse const iterator to a location before the start of this view.
+     */
+    reverse_const_iterator crend() const {
+        return rend();
+    }
+
+public:
+    /**
+     * @return Const pointer to the underlying **igraph** vector object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    operator const igraph_type*() const {
+        return &my_vector;
+    }
+
+    /**
+     * @return Const pointer to the underlying **igraph** vector object.
+     * This is guaranteed to be non-NULL and initialized.
+     */
+    const igraph_type* get() const {
+        return &my_vector;
+    }
+
+private:
+    igraph_type my_vector;
+};
+
+/**
+ * View of an array of **igraph** integers.
+ */
+typedef VectorView<internal::Integer> IntVectorView;
+
+/**
+ * View of an array of **igraph** reals.
+ */
+typedef VectorView<internal::Real> RealVectorView;
+
+/**
+ * View of an array of **igraph** booleans.
+ */
+typedef VectorView<internal::Bool> BoolVectorView;
+
+}
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef RAIIGRAPH_ALGORITHMS_HPP
+#define RAIIGRAPH_ALGORITHMS_HPP
+
+#include "igraph.h"
+#include "parallelize.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include <utility>
+
+/**
+ * @file algorithms.hpp
+ * @brief Parallel versions of common STL algorithms.
+ *
+ * These functions accept random-access iterators, so they can be used with the contiguous `Vector` and `Matrix` iterators
+ * as well as the strided iterators of the row/column views from `Matrix::row()` and `Matrix::column()`.
+ * Each function also has an overload that accepts a range (i.e., an object with `begin()` and `end()` methods) for convenience.
+ */
+
+namespace raiigraph {
+
+/**
+ * Sort the elements of a range in parallel.
+ * Each worker sorts a contiguous block of the range, and the sorted blocks are then merged in successive rounds,
+ * where each round merges pairs of adjacent blocks in parallel.
+ * Note that, like `std::sort()`, this is not a stable sort.
+ *
+ * @tparam Iterator_ Random-access iterator.
+ * @tparam Compare_ Comparison function.
+ * @param first Iterator to the start of the range.
+ * @param last Iterator to the end of the range.
+ * @param num_threads Number of threads to use.
+ * @param compare Comparison function that returns `true` if the first argument should be ordered before the second.
+ */
+template<typename Iterator_, class Compare_ = std::less<>>
+void parallel_sort(Iterator_ first, Iterator_ last, int num_threads, Compare_ compare = Compare_()) {
+    igraph_int_t n = last - first;
+    igraph_int_t nblocks = std::min(static_cast<igraph_int_t>(std::max(num_threads, 1)), n);
+    if (nblocks <= 1) {
+        std::sort(first, last, compare);
+        return;
+    }
+
+    std::vector<igraph_int_t> boundaries;
+    boundaries.reserve(nblocks + 1);
+    boundaries.push_back(0);
+    igraph_int_t per_block = n / nblocks, remainder = n % nblocks;
+    for (igraph_int_t b = 0; b < nblocks; ++b) {
+        boundaries.push_back(boundaries.back() + per_block + (b < remainder));
+    }
+
+    parallelize(num_threads, nblocks, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+        for (igraph_int_t b = start, end = start + length; b < end; ++b) {
+            std::sort(first + boundaries[b], first + boundaries[b + 1], compare);
+        }
+    });
+
+    while (boundaries.size() > 2) {
+        igraph_int_t npairs = (boundaries.size() - 1) / 2;
+        parallelize(num_threads, npairs, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t p = start, end = start + length; p < end; ++p) {
+                std::inplace_merge(first + boundaries[2 * p], first + boundaries[2 * p + 1], first + boundaries[2 * p + 2], compare);
+            }
+        });
+
+        // Dropping every second boundary, as the corresponding pairs of blocks have now been merged.
+        std::size_t counter = 0;
+        for (std::size_t b = 0; b < boundaries.size(); b += 2) {
+            boundaries[counter] = boundaries[b];
+            ++counter;
+        }
+        if (boundaries.size() % 2 == 0) { // i.e., an odd number of blocks, so the end of the last (unmerged) block was skipped.
+            boundaries[counter] = boundaries.back();
+            ++counter;
+        }
+        boundaries.resize(counter);
+    }
+}
+
+/**
+ * Sort the elements of a range in parallel.
+ *
+ * @tparam Range_ Range with random-access `begin()` and `end()` methods, e.g., `Vector`, `Matrix`, `Matrix::View`.
+ * @tparam Compare_ Comparison function.
+ * @param range The range to be sorted.
+ * @param num_threads Number of threads to use.
+ * @param compare Comparison function that returns `true` if the first argument should be ordered before the second.
+ */
+template<class Range_, class Compare_ = std::less<>, typename = decltype(std::declval<Range_&>().begin())>
+void parallel_sort(Range_&& range, int num_threads, Compare_ compare = Compare_()) {
+    parallel_sort(range.begin(), range.end(), num_threads, std::move(compare));
+}
+
+/**
+ * Apply a function to each element of a range in parallel, storing the results in an output range.
+ *
+ * @tparam InputIterator_ Random-access iterator for the input.
+ * @tparam OutputIterator_ Random-access iterator for the output.
+ * @tparam Function_ Unary function.
+ * @param first Iterator to the start of the input range.
+ * @param last Iterator to the end of the input range.
+ * @param output Iterator to the start of the output range, which should be at least as long as the input.
+ * This may be the same as `first` for in-place transformation, but should not otherwise overlap with the input range.
+ * @param fun Function that accepts an element of the input range and returns the corresponding output value.
+ * This will be called concurrently from multiple threads.
+ * @param num_threads Number of threads to use.
+ */
+template<typename InputIterator_, typename OutputIterator_, class Function_>
+void parallel_transform(InputIterator_ first, InputIterator_ last, OutputIterator_ output, Function_ fun, int num_threads) {
+    parallelize(num_threads, last - first, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+        std::transform(first + start, first + start + length, output + start, fun);
+    });
+}
+
+/**
+ * Apply a function to each element of a range in parallel, replacing each element with the result.
+ *
+ * @tparam Range_ Range with random-access `begin()` and `end()` methods, e.g., `Vector`, `Matrix`, `Matrix::View`.
+ * @tparam Function_ Unary function.
+ * @param range The range to be transformed.
+ * @param fun Function that accepts an element of the range and returns its replacement.
+ * This will be called concurrently from multiple threads.
+ * @param num_threads Number of threads to use.
+ */
+template<class Range_, class Function_>
+void parallel_transform(Range_&& range, Function_ fun, int num_threads) {
+    parallel_transform(range.begin(), range.end(), range.begin(), std::move(fun), num_threads);
+}
+
+/**
+ * Fill a range with a value in parallel.
+ *
+ * @tparam Iterator_ Random-access iterator.
+ * @tparam Value_ Type of the value.
+ * @param first Iterator to the start of the range.
+ * @param last Iterator to the end of the range.
+ * @param value Value to fill the range with.
+ * @param num_threads Number of threads to use.
+ */
+template<typename Iterator_, typename Value_>
+void parallel_fill(Iterator_ first, Iterator_ last, const Value_& value, int num_threads) {
+    parallelize(num_threads, last - first, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+        std::fill_n(first + start, length, value);
+    });
+}
+
+/**
+ * Fill a range with a value in parallel.
+ *
+ * @tparam Range_ Range with random-access `begin()` and `end()` methods, e.g., `Vector`, `Matrix`, `Matrix::View`.
+ * @tparam Value_ Type of the value.
+ * @param range The range to be filled.
+ * @param value Value to fill the range with.
+ * @param num_threads Number of threads to use.
+ */
+template<class Range_, typename Value_>
+void parallel_fill(Range_&& range, const Value_& value, int num_threads) {
+    parallel_fill(range.begin(), range.end(), value, num_threads);
+}
+
+/**
+ * Reduce a range in parallel.
+ * Each worker reduces a contiguous block of the range, starting from `init`; the per-worker results are then combined in order of their blocks.
+ * This requires `op` to be associative and `init` to be its identity, e.g., zero for addition.
+ * For a fixed `num_threads`, the result is deterministic.
+ *
+ * @tparam Iterator_ Random-access iterator.
+ * @tparam Value_ Type of the result.
+ * @tparam Operation_ Binary operation.
+ * @param first Iterator to the start of the range.
+ * @param last Iterator to the end of the range.
+ * @param init Initial value, which should be the identity for `op`.
+ * @param op Binary operation that accepts two `Value_`s and returns their combination.
+ * This will be called concurrently from multiple threads.
+ * @param num_threads Number of threads to use.
+ * @return Reduction of all elements in the range.
+ */
+template<typename Iterator_, typename Value_, class Operation_>
+Value_ parallel_reduce(Iterator_ first, Iterator_ last, Value_ init, Operation_ op, int num_threads) {
+    // Wrapping each partial in a struct so that vector<bool> does not pack them into shared words.
+    struct Partial {
+        Value_ value;
+    };
+    std::vector<Partial> partials(static_cast<std::size_t>(std::max(num_threads, 1)), Partial{ init });
+    parallelize(num_threads, last - first, [&](int t, igraph_int_t start, igraph_int_t length) -> void {
+        auto current = init; // accumulating locally to avoid false sharing.
+        for (auto it = first + start, end = it + length; it != end; ++it) {
+            current = op(current, *it);
+        }
+        partials[t].value = std::move(current);
+    });
+
+    for (const auto& p : partials) {
+        init = op(init, p.value);
+    }
+    return init;
+}
+
+/**
+ * Reduce a range in parallel.
+ *
+ * @tparam Range_ Range with random-access `begin()` and `end()` methods, e.g., `Vector`, `Matrix`, `Matrix::View`.
+ * @tparam Value_ Type of the result.
+ * @tparam Operation_ Binary operation.
+ * @param range The range to be reduced.
+ * @param init Initial value, which should be the identity for `op`.
+ * @param op Binary operation that accepts two `Value_`s and returns their combination.
+ * This will be called concurrently from multiple threads.
+ * @param num_threads Number of threads to use.
+ * @return Reduction of all elements in the range.
+ */
+template<class Range_, typename Value_, class Operation_>
+Value_ parallel_reduce(Range_&& range, Value_ init, Operation_ op, int num_threads) {
+    return parallel_reduce(range.begin(), range.end(), std::move(init), std::move(op), num_threads);
+}
+
+}
+
+#endif
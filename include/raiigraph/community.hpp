@@ -0,0 +1,460 @@
+#ifndef RAIIGRAPH_COMMUNITY_HPP
+#define RAIIGRAPH_COMMUNITY_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "Vector.hpp"
+#include "Matrix.hpp"
+#include "VectorView.hpp"
+#include "Graph.hpp"
+#include "RNGScope.hpp"
+#include "parallelize.hpp"
+
+#include <vector>
+
+/**
+ * @file community.hpp
+ * @brief Wrappers around **igraph**'s community detection functions.
+ *
+ * Each function fills a result object that can be re-used across calls as a workspace,
+ * i.e., the existing capacity of its vectors and matrices is re-used when detecting communities in graphs of the same or smaller size.
+ * Overloads are also available that return a new result object.
+ *
+ * It is assumed that users have already called `igraph_setup()` or `initialize()`, and that the default **igraph** RNG has been set (e.g., with `RNGScope`) for reproducible results.
+ */
+
+namespace raiigraph {
+
+/**
+ * @brief Results of multi-level community detection.
+ */
+struct MultilevelResult {
+    /**
+     * Community assignment for each vertex at the level with the highest modularity.
+     */
+    IntVector membership;
+
+    /**
+     * Community assignments at each level.
+     * Each row corresponds to a level and each column corresponds to a vertex.
+     * This is only filled if requested in `cluster_multilevel()`, otherwise it is left untouched.
+     */
+    IntMatrix levels;
+
+    /**
+     * Modularity at each level.
+     */
+    RealVector modularity;
+};
+
+/**
+ * Multi-level community detection, see `igraph_community_multilevel()` for details.
+ *
+ * @param graph An undirected graph.
+ * @param weights Pointer to a vector of edge weights of length equal to the number of edges.
+ * If NULL, all edges are assumed to have equal weight.
+ * @param resolution Resolution parameter, where larger values yield more communities.
+ * @param[out] output Object in which to store the results, see `MultilevelResult` for details.
+ * @param report_levels Whether to report the community assignments at each level.
+ */
+inline void cluster_multilevel(const Graph& graph, const igraph_vector_t* weights, igraph_real_t resolution, MultilevelResult& output, bool report_levels = false) {
+    check_code(igraph_community_multilevel(
+        graph.get(),
+        weights,
+        resolution,
+        output.membership.get(),
+        (report_levels ? output.levels.get() : NULL),
+        output.modularity.get()
+    ));
+}
+
+/**
+ * Overload of `cluster_multilevel()` that returns a new result object.
+ *
+ * @param graph An undirected graph.
+ * @param weights Pointer to a vector of edge weights, see the other overload for details.
+ * @param resolution Resolution parameter.
+ * @param report_levels Whether to report the community assignments at each level.
+ * @return Results of the community detection.
+ */
+inline MultilevelResult cluster_multilevel(const Graph& graph, const igraph_vector_t* weights = NULL, igraph_real_t resolution = 1, bool report_levels = false) {
+    MultilevelResult output;
+    cluster_multilevel(graph, weights, resolution, output, report_levels);
+    return output;
+}
+
+/**
+ * @brief Results of community detection with the Leiden algorithm.
+ */
+struct LeidenResult {
+    /**
+     * Community assignment for each vertex.
+     * This is also used as the initial assignment if `start = true` in `cluster_leiden()`,
+     * so re-using the same result object allows each call to refine the previous assignment.
+     */
+    IntVector membership;
+
+    /**
+     * Number of communities.
+     */
+    igraph_int_t nb_clusters = 0;
+
+    /**
+     * Quality of the partition, as defined by the objective function.
+     */
+    igraph_real_t quality = 0;
+};
+
+/**
+ * Community detection with the Leiden algorithm, see `igraph_community_leiden()` for details.
+ * This optimizes the constant Potts model by default; modularity can be optimized by supplying the vertex strengths as the vertex weights and scaling the resolution by the inverse of the total edge weight.
+ *
+ * @param graph A graph.
+ * @param edge_weights Pointer to a vector of edge weights of length equal to the number of edges.
+ * If NULL, all edges are assumed to have unit weight.
+ * @param vertex_out_weights Pointer to a vector of vertex (out-)weights of length equal to the number of vertices.
+ * If NULL, all vertices are assumed to have unit weight.
+ * @param vertex_in_weights Pointer to a vector of vertex in-weights for directed graphs.
+ * This should be NULL for undirected graphs.
+ * @param resolution Resolution parameter, where larger values yield more communities.
+ * @param beta Randomness in the refinement step.
+ * @param start Whether to use the existing `LeidenResult::membership` in `output` as the initial assignment.
+ * @param n_iterations Number of iterations, or a negative value to iterate until convergence.
+ * @param[out] output Object in which to store the results, see `LeidenResult` for details.
+ */
+inline void cluster_leiden(
+    const Graph& graph,
+    const igraph_vector_t* edge_weights,
+    const igraph_vector_t* vertex_out_weights,
+    const igraph_vector_t* vertex_in_weights,
+    igraph_real_t resolution,
+    igraph_real_t beta,
+    igraph_bool_t start,
+    igraph_int_t n_iterations,
+    LeidenResult& output)
+{
+    check_code(igraph_community_leiden(
+        graph.get(),
+        edge_weights,
+        vertex_out_weights,
+        vertex_in_weights,
+        resolution,
+        beta,
+        start,
+        n_iterations,
+        output.membership.get(),
+        &(output.nb_clusters),
+        &(output.quality)
+    ));
+}
+
+/**
+ * Overload of `cluster_leiden()` that returns a new result object, starting from a singleton partition.
+ *
+ * @param graph A graph.
+ * @param edge_weights Pointer to a vector of edge weights, see the other overload for details.
+ * @param resolution Resolution parameter.
+ * @param beta Randomness in the refinement step.
+ * @param n_iterations Number of iterations, or a negative value to iterate until convergence.
+ * @return Results of the community detection.
+ */
+inline LeidenResult cluster_leiden(const Graph& graph, const igraph_vector_t* edge_weights = NULL, igraph_real_t resolution = 1, igraph_real_t beta = 0.01, igraph_int_t n_iterations = 2) {
+    LeidenResult output;
+    cluster_leiden(graph, edge_weights, NULL, NULL, resolution, beta, false, n_iterations, output);
+    return output;
+}
+
+/**
+ * @brief Results of a Leiden sweep over multiple resolutions.
+ */
+struct LeidenSweepResult {
+    /**
+     * Community assignments, where each row corresponds to a vertex and each column corresponds to a resolution.
+     */
+    IntMatrix membership;
+
+    /**
+     * Number of communities for each resolution.
+     */
+    IntVector nb_clusters;
+
+    /**
+     * Quality of the partition for each resolution.
+     */
+    RealVector quality;
+};
+
+/**
+ * Run the Leiden algorithm at multiple resolutions in parallel, see `cluster_leiden()` for details.
+ * Each resolution is a separate task that starts from a singleton partition and uses its own RNG, seeded from `seed` and the index of the resolution (see `RNGStreamFactory`).
+ * This means that the results for each resolution are reproducible and do not depend on the number of threads.
+ *
+ * Each worker uses its own copy of the graph, as **igraph** may modify the graph's property cache during community detection.
+ * If `has_thread_local_rng()` is false, all resolutions are processed in the calling thread, as the default RNG cannot be set separately for each worker.
+ *
+ * @param graph An undirected graph.
+ * @param edge_weights Pointer to a vector of edge weights of length equal to the number of edges.
+ * If NULL, all edges are assumed to have unit weight.
+ * @param vertex_weights Pointer to a vector of vertex weights of length equal to the number of vertices.
+ * If NULL, all vertices are assumed to have unit weight.
+ * @param resolutions Resolution parameters to use.
+ * A `RealVector` or `std::vector<igraph_real_t>` can also be supplied here.
+ * @param beta Randomness in the refinement step.
+ * @param n_iterations Number of iterations, or a negative value to iterate until convergence.
+ * @param seed Seed for the RNGs.
+ * @param num_threads Number of threads to use.
+ * @param[out] output Object in which to store the results, see `LeidenSweepResult` for details.
+ */
+inline void cluster_leiden_sweep(
+    const Graph& graph,
+    const igraph_vector_t* edge_weights,
+    const igraph_vector_t* vertex_weights,
+    const RealVectorView& resolutions,
+    igraph_real_t beta,
+    igraph_int_t n_iterations,
+    igraph_uint_t seed,
+    int num_threads,
+    LeidenSweepResult& output)
+{
+    igraph_int_t nvertices = graph.vcount();
+    igraph_int_t nres = resolutions.size();
+    output.membership.resize(nvertices, nres);
+    output.nb_clusters.resize(nres);
+    output.quality.resize(nres);
+
+    // Falling back to serial execution if the RNG is shared across threads, otherwise each RNGScope would clobber the others.
+    int nworkers = (has_thread_local_rng() ? num_threads : 1);
+    RNGStreamFactory factory(seed);
+    parallelize(nworkers, nres, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+        Graph copy(graph);
+        LeidenResult workspace;
+
+        for (igraph_int_t r = start, end = start + length; r < end; ++r) {
+            RNGScope scope(factory, r);
+            cluster_leiden(copy, edge_weights, vertex_weights, NULL, resolutions[r], beta, false, n_iterations, workspace);
+            std::copy(workspace.membership.begin(), workspace.membership.end(), output.membership.begin() + r * nvertices);
+            output.nb_clusters[r] = workspace.nb_clusters;
+            output.quality[r] = workspace.quality;
+        }
+    });
+}
+
+/**
+ * Overload of `cluster_leiden_sweep()` that returns a new result object.
+ *
+ * @param graph An undirected graph.
+ * @param edge_weights Pointer to a vector of edge weights, see the other overload for details.
+ * @param resolutions Resolution parameters to use.
+ * @param seed Seed for the RNGs.
+ * @param num_threads Number of threads to use.
+ * @param beta Randomness in the refinement step.
+ * @param n_iterations Number of iterations, or a negative value to iterate until convergence.
+ * @return Results of the community detection at each resolution.
+ */
+inline LeidenSweepResult cluster_leiden_sweep(
+    const Graph& graph,
+    const igraph_vector_t* edge_weights,
+    const RealVectorView& resolutions,
+    igraph_uint_t seed = 42,
+    int num_threads = 1,
+    igraph_real_t beta = 0.01,
+    igraph_int_t n_iterations = 2)
+{
+    LeidenSweepResult output;
+    cluster_leiden_sweep(graph, edge_weights, NULL, resolutions, beta, n_iterations, seed, num_threads, output);
+    return output;
+}
+
+/**
+ * @brief Results of consensus clustering.
+ */
+struct ConsensusResult {
+    /**
+     * Consensus community assignment for each vertex.
+     */
+    IntVector membership;
+
+    /**
+     * Number of consensus communities.
+     */
+    igraph_int_t nb_clusters = 0;
+
+    /**
+     * Stability of each edge, defined as the proportion of runs in which the two vertices of the edge were assigned to the same community.
+     */
+    RealVector stability;
+};
+
+/**
+ * Consensus clustering from multiple runs of the Leiden algorithm with different seeds, see `cluster_leiden()` for details.
+ * Each run is a separate task that uses its own RNG, seeded from `seed` and the index of the run (see `RNGStreamFactory`), so the results do not depend on the number of threads.
+ * Co-assignment of vertices is only tracked for pairs of vertices that are connected by an edge, yielding a stability value for each edge.
+ * The consensus assignment is then obtained by a final run of the Leiden algorithm where each edge weight is multiplied by its stability.
+ *
+ * As in `cluster_leiden_sweep()`, each worker uses its own copy of the graph,
+ * and all runs are processed in the calling thread if `has_thread_local_rng()` is false.
+ *
+ * @param graph An undirected graph.
+ * @param edge_weights Pointer to a vector of edge weights of length equal to the number of edges.
+ * If NULL, all edges are assumed to have unit weight.
+ * @param vertex_weights Pointer to a vector of vertex weights of length equal to the number of vertices.
+ * If NULL, all vertices are assumed to have unit weight.
+ * @param resolution Resolution parameter, where larger values yield more communities.
+ * @param beta Randomness in the refinement step.
+ * @param n_iterations Number of iterations, or a negative value to iterate until convergence.
+ * @param num_runs Number of runs with different seeds.
+ * @param seed Seed for the RNGs.
+ * @param num_threads Number of threads to use.
+ * @param[out] output Object in which to store the results, see `ConsensusResult` for details.
+ */
+inline void cluster_leiden_consensus(
+    const Graph& graph,
+    const igraph_vector_t* edge_weights,
+    const igraph_vector_t* vertex_weights,
+    igraph_real_t resolution,
+    igraph_real_t beta,
+    igraph_int_t n_iterations,
+    igraph_int_t num_runs,
+    igraph_uint_t seed,
+    int num_threads,
+    ConsensusResult& output)
+{
+    if (num_runs <= 0) {
+        throw IgraphError(IGRAPH_EINVAL);
+    }
+
+    igraph_int_t nedges = graph.ecount();
+    auto edges = graph.edges();
+    int nworkers = (has_thread_local_rng() ? std::max(num_threads, 1) : 1);
+    std::vector<std::vector<igraph_int_t> > partials(nworkers);
+
+    RNGStreamFactory factory(seed);
+    parallelize(nworkers, num_runs, [&](int w, igraph_int_t start, igraph_int_t length) -> void {
+        Graph copy(graph);
+        LeidenResult workspace;
+        auto& counts = partials[w];
+        counts.resize(nedges);
+
+        for (igraph_int_t r = start, end = start + length; r < end; ++r) {
+            RNGScope scope(factory, r);
+            cluster_leiden(copy, edge_weights, vertex_weights, NULL, resolution, beta, false, n_iterations, workspace);
+            auto mptr = workspace.membership.data();
+            for (auto edge : edges) {
+                counts[edge.id] += (mptr[edge.from] == mptr[edge.to]);
+            }
+        }
+    });
+
+    output.stability.resize(nedges);
+    std::fill(output.stability.begin(), output.stability.end(), 0);
+    for (const auto& counts : partials) {
+        if (counts.empty()) { // worker was not used.
+            continue;
+        }
+        for (igraph_int_t e = 0; e < nedges; ++e) {
+            output.stability[e] += counts[e];
+        }
+    }
+    for (auto& s : output.stability) {
+        s /= num_runs;
+    }
+
+    RealVector consensus_weights(output.stability);
+    if (edge_weights != NULL) {
+        for (igraph_int_t e = 0; e < nedges; ++e) {
+            consensus_weights[e] *= edge_weights->stor_begin[e];
+        }
+    }
+
+    LeidenResult final_result;
+    final_result.membership.swap(output.membership);
+    {
+        RNGScope scope(factory, num_runs);
+        cluster_leiden(graph, consensus_weights, vertex_weights, NULL, resolution, beta, false, n_iterations, final_result);
+    }
+    output.membership.swap(final_result.membership);
+    output.nb_clusters = final_result.nb_clusters;
+}
+
+/**
+ * Overload of `cluster_leiden_consensus()` that returns a new result object.
+ *
+ * @param graph An undirected graph.
+ * @param edge_weights Pointer to a vector of edge weights, see the other overload for details.
+ * @param num_runs Number of runs with different seeds.
+ * @param resolution Resolution parameter.
+ * @param seed Seed for the RNGs.
+ * @param num_threads Number of threads to use.
+ * @return Results of the consensus clustering.
+ */
+inline ConsensusResult cluster_leiden_consensus(
+    const Graph& graph,
+    const igraph_vector_t* edge_weights,
+    igraph_int_t num_runs,
+    igraph_real_t resolution = 1,
+    igraph_uint_t seed = 42,
+    int num_threads = 1)
+{
+    ConsensusResult output;
+    cluster_leiden_consensus(graph, edge_weights, NULL, resolution, 0.01, 2, num_runs, seed, num_threads, output);
+    return output;
+}
+
+/**
+ * @brief Results of community detection with random walks.
+ */
+struct WalktrapResult {
+    /**
+     * Merges performed by the algorithm, as a matrix with two columns.
+     * Each row corresponds to a merge between two communities, see `igraph_community_walktrap()` for details.
+     */
+    IntMatrix merges;
+
+    /**
+     * Modularity before each merge and after the last merge.
+     */
+    RealVector modularity;
+
+    /**
+     * Community assignment for each vertex, corresponding to the step with the highest modularity.
+     */
+    IntVector membership;
+};
+
+/**
+ * Community detection with short random walks, see `igraph_community_walktrap()` for details.
+ *
+ * @param graph An undirected graph.
+ * @param weights Pointer to a vector of edge weights of length equal to the number of edges.
+ * If NULL, all edges are assumed to have equal weight.
+ * @param steps Length of the random walks.
+ * @param[out] output Object in which to store the results, see `WalktrapResult` for details.
+ */
+inline void cluster_walktrap(const Graph& graph, const igraph_vector_t* weights, igraph_int_t steps, WalktrapResult& output) {
+    check_code(igraph_community_walktrap(
+        graph.get(),
+        weights,
+        steps,
+        output.merges.get(),
+        output.modularity.get(),
+        output.membership.get()
+    ));
+}
+
+/**
+ * Overload of `cluster_walktrap()` that returns a new result object.
+ *
+ * @param graph An undirected graph.
+ * @param weights Pointer to a vector of edge weights, see the other overload for details.
+ * @param steps Length of the random walks.
+ * @return Results of the community detection.
+ */
+inline WalktrapResult cluster_walktrap(const Graph& graph, const igraph_vector_t* weights = NULL, igraph_int_t steps = 4) {
+    WalktrapResult output;
+    cluster_walktrap(graph, weights, steps, output);
+    return output;
+}
+
+}
+
+#endif
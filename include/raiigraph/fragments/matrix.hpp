@@ -2,6 +2,10 @@
 #define RAIIGRAPH_MATRIX_FUNCTION2(suffix, action) RAIIGRAPH_MATRIX_FUNCTION1(suffix, action)
 #define RAIIGRAPH_MATRIX_FUNCTION(action) RAIIGRAPH_MATRIX_FUNCTION2(RAIIGRAPH_MATRIX_SUFFIX, action)
 
+#define RAIIGRAPH_MATRIX_VECTOR_FUNCTION1(suffix, action) igraph_vector##suffix##_##action
+#define RAIIGRAPH_MATRIX_VECTOR_FUNCTION2(suffix, action) RAIIGRAPH_MATRIX_VECTOR_FUNCTION1(suffix, action)
+#define RAIIGRAPH_MATRIX_VECTOR_FUNCTION(action) RAIIGRAPH_MATRIX_VECTOR_FUNCTION2(RAIIGRAPH_MATRIX_SUFFIX, action)
+
 static auto init(igraph_type* ptr, igraph_int_t nr, igraph_int_t nc) {
     return RAIIGRAPH_MATRIX_FUNCTION(init)(ptr, nr, nc);
 }
@@ -44,6 +48,14 @@ static void shrink_to_fit(igraph_type* ptr) {
     RAIIGRAPH_MATRIX_FUNCTION(resize_min)(ptr);
 }
 
+// igraph doesn't provide a matrix-level reserve, so we go through the underlying vector.
+static auto reserve(igraph_type* ptr, igraph_int_t size) {
+    return RAIIGRAPH_MATRIX_VECTOR_FUNCTION(reserve)(&(ptr->data), size);
+}
+
 #undef RAIIGRAPH_MATRIX_FUNCTION1
 #undef RAIIGRAPH_MATRIX_FUNCTION2
 #undef RAIIGRAPH_MATRIX_FUNCTION
+#undef RAIIGRAPH_MATRIX_VECTOR_FUNCTION1
+#undef RAIIGRAPH_MATRIX_VECTOR_FUNCTION2
+#undef RAIIGRAPH_MATRIX_VECTOR_FUNCTION
@@ -14,6 +14,10 @@ static auto init_array(igraph_type* ptr, const value_type* start, igraph_int_t s
     return RAIIGRAPH_VECTOR_FUNCTION(init_array)(ptr, start, size);
 }
 
+static auto view(const value_type* start, igraph_int_t size) {
+    return RAIIGRAPH_VECTOR_FUNCTION(view)(start, size);
+}
+
 static auto update(igraph_type* ptr, const igraph_type* other) {
     return RAIIGRAPH_VECTOR_FUNCTION(update)(ptr, other);
 }
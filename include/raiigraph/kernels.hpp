@@ -0,0 +1,306 @@
+#ifndef RAIIGRAPH_KERNELS_HPP
+#define RAIIGRAPH_KERNELS_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+
+#include <algorithm>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+/**
+ * @file kernels.hpp
+ * @brief Reductions and elementwise operations on contiguous arrays.
+ */
+
+namespace raiigraph {
+
+/**
+ * @cond
+ */
+namespace internal {
+
+// Number of independent accumulators in each reduction. This breaks the
+// loop-carried dependency on a single accumulator, allowing the compiler to
+// vectorize the loop (SSE/AVX/NEON, depending on the target flags) without
+// any intrinsics in our code.
+constexpr std::size_t kernel_lanes = 8;
+
+// Booleans are summed as integers, otherwise '+=' would just be a logical OR.
+template<typename Value_>
+using kernel_accumulator = typename std::conditional<std::is_same<Value_, igraph_bool_t>::value, igraph_int_t, Value_>::type;
+
+template<typename Value_>
+kernel_accumulator<Value_> sum(const Value_* x, std::size_t n) {
+    kernel_accumulator<Value_> acc[kernel_lanes] = {};
+    std::size_t i = 0;
+    for (; i + kernel_lanes <= n; i += kernel_lanes) {
+        for (std::size_t l = 0; l < kernel_lanes; ++l) {
+            acc[l] += x[i + l];
+        }
+    }
+    for (; i < n; ++i) {
+        acc[0] += x[i];
+    }
+
+    for (std::size_t width = kernel_lanes / 2; width > 0; width /= 2) { // pairwise combination of the lanes.
+        for (std::size_t l = 0; l < width; ++l) {
+            acc[l] += acc[l + width];
+        }
+    }
+    return acc[0];
+}
+
+template<typename Value_>
+kernel_accumulator<Value_> dot(const Value_* x, const Value_* y, std::size_t n) {
+    kernel_accumulator<Value_> acc[kernel_lanes] = {};
+    std::size_t i = 0;
+    for (; i + kernel_lanes <= n; i += kernel_lanes) {
+        for (std::size_t l = 0; l < kernel_lanes; ++l) {
+            acc[l] += x[i + l] * y[i + l];
+        }
+    }
+    for (; i < n; ++i) {
+        acc[0] += x[i] * y[i];
+    }
+
+    for (std::size_t width = kernel_lanes / 2; width > 0; width /= 2) {
+        for (std::size_t l = 0; l < width; ++l) {
+            acc[l] += acc[l + width];
+        }
+    }
+    return acc[0];
+}
+
+template<bool max_, typename Value_>
+std::size_t which_extreme(const Value_* x, std::size_t n) {
+    if (n == 0) {
+        throw IgraphError(IGRAPH_EINVAL);
+    }
+
+    auto better = [](Value_ candidate, Value_ current) -> bool {
+        if constexpr(max_) {
+            return candidate > current;
+        } else {
+            return candidate < current;
+        }
+    };
+
+    // Each lane tracks its own extreme value and the position of its first occurrence.
+    std::size_t main = (n / kernel_lanes) * kernel_lanes;
+    std::size_t best = 0;
+    if (main) {
+        Value_ val[kernel_lanes];
+        std::size_t idx[kernel_lanes];
+        for (std::size_t l = 0; l < kernel_lanes; ++l) {
+            val[l] = x[l];
+            idx[l] = l;
+        }
+
+        for (std::size_t i = kernel_lanes; i < main; i += kernel_lanes) {
+            for (std::size_t l = 0; l < kernel_lanes; ++l) {
+                bool replace = better(x[i + l], val[l]);
+                val[l] = (replace ? x[i + l] : val[l]);
+                idx[l] = (replace ? i + l : idx[l]);
+            }
+        }
+
+        // Breaking ties in favor of the earliest position, to match a sequential scan.
+        best = idx[0];
+        for (std::size_t l = 1; l < kernel_lanes; ++l) {
+            if (better(val[l], x[best]) || (val[l] == x[best] && idx[l] < best)) {
+                best = idx[l];
+            }
+        }
+    }
+
+    for (std::size_t i = main; i < n; ++i) {
+        if (better(x[i], x[best])) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+// Whether values of type 'Input_' can be used to modify a container of 'Output_' without silent truncation,
+// e.g., scaling an integer vector by 0.5 would otherwise just zero it.
+template<typename Output_, typename Input_>
+constexpr bool kernel_exact_conversion() {
+    return !std::is_same<Output_, igraph_bool_t>::value && (std::is_floating_point<Output_>::value || !std::is_floating_point<Input_>::value);
+}
+
+template<typename Container_>
+auto kernel_data(Container_& x) -> decltype(x.data()) {
+    return x.data();
+}
+
+template<typename Container_>
+std::size_t kernel_size(const Container_& x) {
+    return static_cast<std::size_t>(x.size());
+}
+
+template<typename Left_, typename Right_>
+std::size_t kernel_check_sizes(const Left_& x, const Right_& y) {
+    auto n = kernel_size(x);
+    if (n != kernel_size(y)) {
+        throw IgraphError(IGRAPH_EINVAL);
+    }
+    return n;
+}
+
+}
+/**
+ * @endcond
+ */
+
+/**
+ * Compute the sum of all values in a contiguous container.
+ * For floating-point values, the order of summation is not strictly sequential, so the result may differ from a naive loop by a few ULPs.
+ *
+ * @tparam Container_ Contiguous container that provides the `data()` and `size()` methods, e.g., `Vector`, `VectorView`, `Matrix`, `std::vector`.
+ * @param x Instance of the container.
+ * @return Sum of all values in `x`.
+ * For `igraph_bool_t` values, this is an `igraph_int_t` containing the number of true values.
+ */
+template<class Container_>
+auto sum(const Container_& x) {
+    return internal::sum(internal::kernel_data(x), internal::kernel_size(x));
+}
+
+/**
+ * Compute the dot product of two contiguous containers.
+ * For floating-point values, the order of summation is not strictly sequential, so the result may differ from a naive loop by a few ULPs.
+ *
+ * @tparam Left_ Contiguous container that provides the `data()` and `size()` methods, e.g., `Vector`, `VectorView`, `Matrix`, `std::vector`.
+ * @tparam Right_ Contiguous container with the same value type as `Left_`.
+ * @param x Instance of the first container.
+ * @param y Instance of the second container, of the same size as `x`.
+ * @return Dot product of `x` and `y`.
+ * For `igraph_bool_t` values, this is an `igraph_int_t` containing the number of positions where both are true.
+ * An `IgraphError` is thrown if the sizes are not equal.
+ */
+template<class Left_, class Right_>
+auto dot(const Left_& x, const Right_& y) {
+    auto n = internal::kernel_check_sizes(x, y);
+    return internal::dot(internal::kernel_data(x), internal::kernel_data(y), n);
+}
+
+/**
+ * Find the position of the smallest value in a contiguous container.
+ * If the minimum occurs multiple times, the first position is reported.
+ * The result is unspecified if any NaNs are present.
+ *
+ * @tparam Container_ Contiguous container that provides the `data()` and `size()` methods, e.g., `Vector`, `VectorView`, `Matrix`, `std::vector`.
+ * @param x Instance of the container.
+ * @return Pair containing the position of the minimum and the minimum itself.
+ * An `IgraphError` is thrown if `x` is empty.
+ */
+template<class Container_>
+auto which_min(const Container_& x) {
+    auto ptr = internal::kernel_data(x);
+    auto i = internal::which_extreme<false>(ptr, internal::kernel_size(x));
+    return std::make_pair(static_cast<igraph_int_t>(i), ptr[i]);
+}
+
+/**
+ * Find the position of the largest value in a contiguous container.
+ * If the maximum occurs multiple times, the first position is reported.
+ * The result is unspecified if any NaNs are present.
+ *
+ * @tparam Container_ Contiguous container that provides the `data()` and `size()` methods, e.g., `Vector`, `VectorView`, `Matrix`, `std::vector`.
+ * @param x Instance of the container.
+ * @return Pair containing the position of the maximum and the maximum itself.
+ * An `IgraphError` is thrown if `x` is empty.
+ */
+template<class Container_>
+auto which_max(const Container_& x) {
+    auto ptr = internal::kernel_data(x);
+    auto i = internal::which_extreme<true>(ptr, internal::kernel_size(x));
+    return std::make_pair(static_cast<igraph_int_t>(i), ptr[i]);
+}
+
+/**
+ * Add a scaled copy of one container to another, i.e., `y += alpha * x`.
+ *
+ * @tparam Input_ Contiguous container that provides the `data()` and `size()` methods, e.g., `Vector`, `VectorView`, `Matrix`, `std::vector`.
+ * @tparam Output_ Contiguous container with a non-const `data()` method, e.g., `Vector`, `Matrix`, `std::vector`.
+ * @tparam Value_ Type of the scaling factor.
+ * This should be an integer type if `Output_` holds integers, as floating-point values would otherwise be truncated;
+ * the same applies to the values of `Input_`.
+ * Boolean outputs are not supported.
+ * Violations are rejected at compile time.
+ * @param alpha Scaling factor.
+ * @param x Instance of the input container.
+ * @param[in,out] y Instance of the output container, of the same size as `x`.
+ * On output, this is incremented by the scaled values of `x`.
+ * An `IgraphError` is thrown if the sizes are not equal.
+ */
+template<class Input_, class Output_, typename Value_>
+void axpy(Value_ alpha, const Input_& x, Output_& y) {
+    auto n = internal::kernel_check_sizes(x, y);
+    auto xptr = internal::kernel_data(x);
+    auto yptr = internal::kernel_data(y);
+    typedef typename std::remove_reference<decltype(*yptr)>::type Output;
+    typedef typename std::remove_const<typename std::remove_reference<decltype(*xptr)>::type>::type Input;
+    static_assert(internal::kernel_exact_conversion<Output, Value_>() && internal::kernel_exact_conversion<Output, Input>(), "floating-point values cannot be added to integer or boolean containers");
+    auto a = static_cast<Output>(alpha);
+    for (std::size_t i = 0; i < n; ++i) {
+        yptr[i] += a * xptr[i];
+    }
+}
+
+/**
+ * Scale all values of a container in place, i.e., `x *= alpha`.
+ *
+ * @tparam Container_ Contiguous container with a non-const `data()` method, e.g., `Vector`, `Matrix`, `std::vector`.
+ * @tparam Value_ Type of the scaling factor.
+ * This should be an integer type if `Container_` holds integers, and boolean containers are not supported.
+ * Violations are rejected at compile time.
+ * @param[in,out] x Instance of the container.
+ * On output, all values are multiplied by `alpha`.
+ * @param alpha Scaling factor.
+ */
+template<class Container_, typename Value_>
+void scale(Container_& x, Value_ alpha) {
+    auto ptr = internal::kernel_data(x);
+    auto n = internal::kernel_size(x);
+    typedef typename std::remove_reference<decltype(*ptr)>::type Output;
+    static_assert(internal::kernel_exact_conversion<Output, Value_>(), "integer or boolean containers cannot be scaled by a floating-point value");
+    auto a = static_cast<Output>(alpha);
+    for (std::size_t i = 0; i < n; ++i) {
+        ptr[i] *= a;
+    }
+}
+
+/**
+ * Clamp all values of a container in place to the interval `[lower, upper]`.
+ *
+ * @tparam Container_ Contiguous container with a non-const `data()` method, e.g., `Vector`, `Matrix`, `std::vector`.
+ * @tparam Value_ Type of the bounds.
+ * This should be an integer type if `Container_` holds integers, and boolean containers are not supported.
+ * Violations are rejected at compile time.
+ * @param[in,out] x Instance of the container.
+ * On output, values below `lower` are set to `lower` and values above `upper` are set to `upper`.
+ * @param lower Lower bound.
+ * @param upper Upper bound, should be no less than `lower`.
+ * An `IgraphError` is thrown if `upper < lower`.
+ */
+template<class Container_, typename Value_>
+void clamp(Container_& x, Value_ lower, Value_ upper) {
+    if (upper < lower) {
+        throw IgraphError(IGRAPH_EINVAL);
+    }
+    auto ptr = internal::kernel_data(x);
+    auto n = internal::kernel_size(x);
+    typedef typename std::remove_reference<decltype(*ptr)>::type Output;
+    static_assert(internal::kernel_exact_conversion<Output, Value_>(), "integer or boolean containers cannot be clamped to floating-point bounds");
+    auto lo = static_cast<Output>(lower), hi = static_cast<Output>(upper);
+    for (std::size_t i = 0; i < n; ++i) {
+        ptr[i] = std::min(std::max(ptr[i], lo), hi); // written branch-free so that the compiler can vectorize it.
+    }
+}
+
+}
+
+#endif
@@ -0,0 +1,90 @@
+#ifndef RAIIGRAPH_PARALLELIZE_HPP
+#define RAIIGRAPH_PARALLELIZE_HPP
+
+#include "igraph.h"
+
+#include <vector>
+#include <thread>
+#include <exception>
+#include <algorithm>
+
+/**
+ * @file parallelize.hpp
+ * @brief Parallelize tasks across threads.
+ */
+
+namespace raiigraph {
+
+/**
+ * Split `num_tasks` tasks into contiguous blocks of roughly equal size, and execute each block in a separate worker.
+ * By default, this uses `std::thread` to create one thread per worker.
+ * Users can define the `RAIIGRAPH_CUSTOM_PARALLEL` function-like macro to use a different parallelization scheme, e.g., OpenMP or a thread pool.
+ * This macro should accept the same arguments as `parallelize()` and have the same behavior.
+ *
+ * Note that **igraph** functions are not guaranteed to be thread-safe, depending on how the library was compiled.
+ * `fun` should only use thread-safe functions, e.g., operations on **raiigraph** containers that do not (re)allocate memory.
+ *
+ * @tparam Function_ Function to be executed by each worker.
+ * @param num_workers Number of workers.
+ * If this is less than 1, only one worker is used.
+ * @param num_tasks Number of tasks.
+ * @param fun Function to be executed by each worker.
+ * This should accept three arguments - the worker ID, the index of the first task in the block, and the number of tasks in the block.
+ * Each worker is called at most once, and workers are not called if their block is empty.
+ * If `fun` throws in any worker, the first exception is rethrown in the calling thread after all workers have finished.
+ */
+template<class Function_>
+void parallelize(int num_workers, igraph_int_t num_tasks, Function_ fun) {
+#ifdef RAIIGRAPH_CUSTOM_PARALLEL
+    RAIIGRAPH_CUSTOM_PARALLEL(num_workers, num_tasks, std::move(fun));
+#else
+    if (num_tasks <= 0) {
+        return;
+    }
+
+    igraph_int_t workers = std::min(static_cast<igraph_int_t>(std::max(num_workers, 1)), num_tasks);
+    if (workers == 1) {
+        fun(0, 0, num_tasks);
+        return;
+    }
+
+    igraph_int_t per_worker = num_tasks / workers;
+    igraph_int_t remainder = num_tasks % workers;
+    std::vector<std::exception_ptr> errors(workers);
+    std::vector<std::thread> threads;
+    threads.reserve(workers - 1);
+
+    auto run = [&](int w, igraph_int_t start, igraph_int_t length) -> void {
+        try {
+            fun(w, start, length);
+        } catch (...) {
+            errors[w] = std::current_exception();
+        }
+    };
+
+    igraph_int_t start = 0;
+    for (igraph_int_t w = 0; w < workers; ++w) {
+        igraph_int_t length = per_worker + (w < remainder);
+        if (w + 1 == workers) {
+            run(w, start, length); // re-using the calling thread for the last block.
+        } else {
+            threads.emplace_back(run, static_cast<int>(w), start, length);
+        }
+        start += length;
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    for (const auto& e : errors) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+#endif
+}
+
+}
+
+#endif
@@ -3,8 +3,21 @@
 
 #include "RNGScope.hpp"
 #include "Vector.hpp"
+#include "VectorView.hpp"
 #include "Matrix.hpp"
+#include "MatrixView.hpp"
+#include "kernels.hpp"
+#include "parallelize.hpp"
+#include "algorithms.hpp"
 #include "Graph.hpp"
+#include "AdjacencySnapshot.hpp"
+#include "AdjList.hpp"
+#include "EdgeRange.hpp"
+#include "IncidenceRange.hpp"
+#include "GraphBuilder.hpp"
+#include "SparseMatrix.hpp"
+#include "snn.hpp"
+#include "community.hpp"
 #include "initialize.hpp"
 
 /**
@@ -0,0 +1,194 @@
+#ifndef RAIIGRAPH_SNN_HPP
+#define RAIIGRAPH_SNN_HPP
+
+#include "igraph.h"
+#include "error.hpp"
+#include "Vector.hpp"
+#include "MatrixView.hpp"
+#include "Graph.hpp"
+#include "parallelize.hpp"
+
+#include <vector>
+#include <algorithm>
+#include <numeric>
+
+/**
+ * @file snn.hpp
+ * @brief Build a shared nearest-neighbor graph.
+ */
+
+namespace raiigraph {
+
+/**
+ * Weighting scheme for the edges of a shared nearest-neighbor graph.
+ * Let `k` be the number of neighbors of each observation, where each observation is also considered to be its own neighbor with rank 0.
+ *
+ * - `RANKED`: for each pair of observations, find the shared neighbor with the smallest sum of ranks, and define the weight as `k - 0.5 * sum`.
+ *   This is the approach of Xu and Su (2015).
+ * - `NUMBER`: the weight is defined as the number of shared neighbors.
+ * - `JACCARD`: the weight is defined as the Jaccard index of the two sets of neighbors.
+ *
+ * In all cases, weights are bounded below by a small positive value so that all edges are retained by weighted clustering algorithms.
+ */
+enum class SnnWeightScheme : char { RANKED, NUMBER, JACCARD };
+
+/**
+ * @brief Shared nearest-neighbor graph and its edge weights.
+ */
+struct SnnGraph {
+    /**
+     * Undirected graph where each vertex is an observation.
+     */
+    Graph graph;
+
+    /**
+     * Weight of each edge in `graph`.
+     */
+    RealVector weights;
+};
+
+/**
+ * Build a shared nearest-neighbor (SNN) graph from the nearest neighbors of each observation.
+ * Two observations are connected by an edge if they share at least one neighbor, where each observation is also considered to be its own neighbor.
+ * This is typically used to construct a graph of cells for community detection in single-cell analyses.
+ *
+ * Each thread uses its own scratch space of length equal to the number of observations, and the edges generated by each thread are concatenated in order.
+ * The edges are ordered by the larger of the two vertex IDs and then by the smaller ID, so the output does not depend on the number of threads.
+ *
+ * @param neighbors Matrix of neighbor indices, where each row corresponds to an observation and each column corresponds to the rank of a neighbor.
+ * That is, the `j`-th column of row `i` contains the index of the `j + 1`-th nearest neighbor of observation `i`, not including `i` itself.
+ * All indices should be less than the number of rows, and each row should not contain duplicate indices.
+ * An `IntMatrix` can also be supplied here.
+ * @param scheme Weighting scheme for the edges.
+ * @param num_threads Number of threads to use.
+ * @return The SNN graph and its edge weights.
+ * An `IgraphError` is thrown if any index is out of range, refers to its own row, or is duplicated within a row.
+ */
+inline SnnGraph build_snn_graph(const IntMatrixView& neighbors, SnnWeightScheme scheme = SnnWeightScheme::RANKED, int num_threads = 1) {
+    igraph_int_t nobs = neighbors.nrow();
+    igraph_int_t k = neighbors.ncol();
+    const igraph_int_t* ptr = neighbors.data(); // column-major, so the r-th neighbor of i is at 'ptr[i + r * nobs]'.
+
+    // Building the reverse mapping, i.e., the observations that have each observation as a neighbor and the corresponding rank.
+    // We also check for self-neighbors and duplicates here, as these would inflate the counts of shared neighbors.
+    IntVector host_offsets(nobs + 1);
+    {
+        std::vector<igraph_int_t> last_seen(nobs, -1);
+        for (igraph_int_t i = 0; i < nobs; ++i) {
+            last_seen[i] = i;
+            for (igraph_int_t r = 0; r < k; ++r) {
+                auto n = ptr[i + r * nobs];
+                if (n < 0 || n >= nobs) {
+                    throw IgraphError(IGRAPH_EINVVID);
+                }
+                if (last_seen[n] == i) {
+                    throw IgraphError(IGRAPH_EINVAL);
+                }
+                last_seen[n] = i;
+                ++host_offsets[n + 1];
+            }
+        }
+    }
+    std::partial_sum(host_offsets.begin(), host_offsets.end(), host_offsets.begin());
+
+    IntVector hosts(nobs * k, uninitialized), host_ranks(nobs * k, uninitialized);
+    {
+        std::vector<igraph_int_t> position(host_offsets.begin(), host_offsets.end() - 1);
+        for (igraph_int_t r = 0; r < k; ++r) {
+            auto col = ptr + r * nobs;
+            for (igraph_int_t i = 0; i < nobs; ++i) {
+                auto& pos = position[col[i]];
+                hosts[pos] = i;
+                host_ranks[pos] = r + 1;
+                ++pos;
+            }
+        }
+    }
+
+    struct Partial {
+        std::vector<igraph_int_t> edges;
+        std::vector<igraph_real_t> weights;
+    };
+    int nworkers = std::max(num_threads, 1);
+    std::vector<Partial> partials(nworkers);
+    constexpr igraph_real_t lower_bound = 1e-6;
+
+    parallelize(nworkers, nobs, [&](int w, igraph_int_t start, igraph_int_t length) -> void {
+        auto& partial = partials[w];
+
+        // Per-thread scratch space: either the smallest combined rank or the number of shared neighbors, for each other observation.
+        std::vector<igraph_int_t> scores(nobs, -1);
+        std::vector<igraph_int_t> touched;
+
+        auto update = [&](igraph_int_t other, igraph_int_t rank) -> void {
+            auto& current = scores[other];
+            if (current < 0) {
+                touched.push_back(other);
+                current = (scheme == SnnWeightScheme::RANKED ? rank : 1);
+            } else if (scheme == SnnWeightScheme::RANKED) {
+                current = std::min(current, rank);
+            } else {
+                ++current;
+            }
+        };
+
+        for (igraph_int_t j = start, end = start + length; j < end; ++j) {
+            // Only considering 'other < j' so that each pair is reported once.
+            for (igraph_int_t r = 0; r <= k; ++r) {
+                igraph_int_t shared = (r == 0 ? j : ptr[j + (r - 1) * nobs]);
+                if (shared < j) {
+                    update(shared, r); // the shared neighbor is its own neighbor with rank 0.
+                }
+                for (igraph_int_t h = host_offsets[shared], hend = host_offsets[shared + 1]; h < hend; ++h) {
+                    auto other = hosts[h];
+                    if (other < j) {
+                        update(other, r + host_ranks[h]);
+                    }
+                }
+            }
+
+            std::sort(touched.begin(), touched.end());
+            for (auto other : touched) {
+                igraph_real_t weight;
+                auto score = scores[other];
+                if (scheme == SnnWeightScheme::RANKED) {
+                    weight = static_cast<igraph_real_t>(k) - 0.5 * static_cast<igraph_real_t>(score);
+                } else if (scheme == SnnWeightScheme::NUMBER) {
+                    weight = score;
+                } else {
+                    weight = static_cast<igraph_real_t>(score) / static_cast<igraph_real_t>(2 * (k + 1) - score);
+                }
+                partial.edges.push_back(other);
+                partial.edges.push_back(j);
+                partial.weights.push_back(std::max(weight, lower_bound));
+                scores[other] = -1;
+            }
+            touched.clear();
+        }
+    });
+
+    // Concatenating the edges from each worker, which were generated in order of 'j'.
+    std::vector<igraph_int_t> offsets(nworkers + 1);
+    for (int w = 0; w < nworkers; ++w) {
+        offsets[w + 1] = offsets[w] + partials[w].weights.size();
+    }
+    IntVector edges(2 * offsets.back(), uninitialized);
+    SnnGraph output;
+    output.weights.resize_uninitialized(offsets.back());
+    parallelize(nworkers, nworkers, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+        for (igraph_int_t w = start, end = start + length; w < end; ++w) {
+            auto& partial = partials[w];
+            std::copy(partial.edges.begin(), partial.edges.end(), edges.begin() + 2 * offsets[w]);
+            std::copy(partial.weights.begin(), partial.weights.end(), output.weights.begin() + offsets[w]);
+            std::vector<igraph_int_t>().swap(partial.edges);
+            std::vector<igraph_real_t>().swap(partial.weights);
+        }
+    });
+
+    output.graph = Graph(edges, nobs, false);
+    return output;
+}
+
+}
+
+#endif
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/AdjList.hpp"
+#include "raiigraph/Graph.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <algorithm>
+
+static raiigraph::Graph create_graph() {
+    std::vector<igraph_int_t> edges { 0, 1, 0, 2, 1, 2, 3, 1, 2, 0, 4, 4 };
+    return raiigraph::Graph(raiigraph::IntVectorView(edges), 5, IGRAPH_DIRECTED);
+}
+
+static std::vector<igraph_int_t> to_vector(const raiigraph::IntVectorView& view) {
+    return std::vector<igraph_int_t>(view.begin(), view.end());
+}
+
+TEST(AdjList, Basic) {
+    raiigraph::initialize();
+    auto graph = create_graph();
+
+    raiigraph::AdjList out(graph);
+    EXPECT_EQ(out.size(), 5);
+    EXPECT_EQ(to_vector(out.neighbors(0)), std::vector<igraph_int_t>({ 1, 2 }));
+    EXPECT_EQ(to_vector(out[1]), std::vector<igraph_int_t>({ 2 }));
+    EXPECT_EQ(to_vector(out[4]), std::vector<igraph_int_t>({ 4 }));
+    EXPECT_EQ(igraph_adjlist_size(out.get()), 5);
+
+    raiigraph::AdjList in(graph, IGRAPH_IN);
+    EXPECT_EQ(to_vector(in[1]), std::vector<igraph_int_t>({ 0, 3 }));
+
+    raiigraph::AdjList all(graph, IGRAPH_ALL);
+    EXPECT_EQ(to_vector(all[2]), std::vector<igraph_int_t>({ 0, 0, 1 }));
+
+    // Moving.
+    raiigraph::AdjList moved(std::move(out));
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(out.size(), 0);
+    out = std::move(moved);
+    EXPECT_EQ(to_vector(out.neighbors(0)), std::vector<igraph_int_t>({ 1, 2 }));
+}
+
+TEST(AdjList, Incidence) {
+    raiigraph::initialize();
+    auto graph = create_graph();
+
+    raiigraph::IncList out(graph);
+    EXPECT_EQ(out.size(), 5);
+    EXPECT_EQ(to_vector(out.incident(0)), std::vector<igraph_int_t>({ 0, 1 }));
+    EXPECT_EQ(to_vector(out[3]), std::vector<igraph_int_t>({ 3 }));
+
+    raiigraph::IncList in(graph, IGRAPH_IN);
+    auto in2 = to_vector(in[2]);
+    std::sort(in2.begin(), in2.end());
+    EXPECT_EQ(in2, std::vector<igraph_int_t>({ 1, 2 }));
+
+    raiigraph::IncList moved(std::move(out));
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(out.size(), 0);
+    out = std::move(moved);
+    EXPECT_EQ(out.size(), 5);
+}
+
+TEST(AdjList, Lazy) {
+    raiigraph::initialize();
+    auto graph = create_graph();
+
+    raiigraph::LazyAdjList lazy(graph, IGRAPH_ALL);
+    EXPECT_EQ(lazy.size(), 5);
+    EXPECT_EQ(to_vector(lazy.neighbors(2)), std::vector<igraph_int_t>({ 0, 0, 1 }));
+    EXPECT_EQ(to_vector(lazy[2]), std::vector<igraph_int_t>({ 0, 0, 1 })); // cached.
+
+    raiigraph::LazyAdjList moved(std::move(lazy));
+    EXPECT_EQ(moved.size(), 5);
+    EXPECT_EQ(lazy.size(), 0);
+    EXPECT_EQ(to_vector(moved[1]), std::vector<igraph_int_t>({ 0, 2, 3 }));
+}
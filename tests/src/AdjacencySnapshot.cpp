@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/Graph.hpp"
+#include "raiigraph/AdjacencySnapshot.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+static std::vector<igraph_int_t> simulate_edges(igraph_int_t nvertices, igraph_int_t nedges, int seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<igraph_int_t> edges;
+    for (igraph_int_t e = 0; e < nedges; ++e) {
+        edges.push_back(rng() % nvertices);
+        edges.push_back(rng() % nvertices); // includes self-loops and multi-edges.
+    }
+    return edges;
+}
+
+// Brute-force reference, reporting (neighbor, edge) pairs.
+static std::vector<std::vector<std::pair<igraph_int_t, igraph_int_t> > > reference(const std::vector<igraph_int_t>& edges, igraph_int_t nvertices, bool directed, igraph_neimode_t mode, igraph_loops_t loops) {
+    std::vector<std::vector<std::pair<igraph_int_t, igraph_int_t> > > output(nvertices);
+    igraph_int_t nedges = edges.size() / 2;
+    bool use_out = !directed || mode != IGRAPH_IN;
+    bool use_in = !directed || mode != IGRAPH_OUT;
+    for (igraph_int_t e = 0; e < nedges; ++e) {
+        auto f = edges[2 * e], t = edges[2 * e + 1];
+        if (f == t) {
+            if (loops == IGRAPH_NO_LOOPS) {
+                continue;
+            }
+            output[f].emplace_back(f, e);
+            if (use_out && use_in && loops == IGRAPH_LOOPS_TWICE) {
+                output[f].emplace_back(f, e);
+            }
+            continue;
+        }
+        if (use_out) {
+            output[f].emplace_back(t, e);
+        }
+        if (use_in) {
+            output[t].emplace_back(f, e);
+        }
+    }
+    return output;
+}
+
+class AdjacencySnapshotTest : public ::testing::TestWithParam<std::tuple<bool, igraph_neimode_t, igraph_loops_t, int> > {};
+
+TEST_P(AdjacencySnapshotTest, Basic) {
+    raiigraph::initialize();
+
+    auto param = GetParam();
+    bool directed = std::get<0>(param);
+    auto mode = std::get<1>(param);
+    auto loops = std::get<2>(param);
+    int nthreads = std::get<3>(param);
+
+    igraph_int_t nvertices = 50;
+    auto edges = simulate_edges(nvertices, 200, 42);
+    raiigraph::Graph graph(raiigraph::IntVectorView(edges), nvertices, directed);
+    auto ref = reference(edges, nvertices, directed, mode, loops);
+
+    auto snapshot = graph.adjacency_snapshot(mode, loops, true, nthreads);
+    EXPECT_EQ(snapshot.vcount(), nvertices);
+    EXPECT_TRUE(snapshot.has_edge_ids());
+    EXPECT_EQ(snapshot.offsets().size(), nvertices + 1);
+
+    for (igraph_int_t v = 0; v < nvertices; ++v) {
+        auto neighbors = snapshot.neighbors(v);
+        auto eids = snapshot.edges(v);
+        EXPECT_EQ(snapshot.degree(v), ref[v].size());
+        EXPECT_TRUE(std::is_sorted(neighbors.begin(), neighbors.end()));
+
+        std::vector<std::pair<igraph_int_t, igraph_int_t> > observed;
+        for (igraph_int_t i = 0; i < neighbors.size(); ++i) {
+            observed.emplace_back(neighbors[i], eids[i]);
+        }
+        auto expected = ref[v];
+        std::sort(observed.begin(), observed.end());
+        std::sort(expected.begin(), expected.end());
+        EXPECT_EQ(observed, expected);
+    }
+
+    // Same results without edge IDs.
+    auto simple = raiigraph::AdjacencySnapshot(graph.get(), mode, loops, false, nthreads);
+    EXPECT_FALSE(simple.has_edge_ids());
+    EXPECT_TRUE(simple.all_edges().empty());
+    EXPECT_EQ(
+        std::vector<igraph_int_t>(simple.all_neighbors().begin(), simple.all_neighbors().end()),
+        std::vector<igraph_int_t>(snapshot.all_neighbors().begin(), snapshot.all_neighbors().end())
+    );
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    AdjacencySnapshot,
+    AdjacencySnapshotTest,
+    ::testing::Combine(
+        ::testing::Values(true, false),
+        ::testing::Values(IGRAPH_OUT, IGRAPH_IN, IGRAPH_ALL),
+        ::testing::Values(IGRAPH_NO_LOOPS, IGRAPH_LOOPS_ONCE, IGRAPH_LOOPS_TWICE),
+        ::testing::Values(1, 3)
+    )
+);
+
+TEST(AdjacencySnapshot, Empty) {
+    raiigraph::initialize();
+
+    raiigraph::AdjacencySnapshot empty;
+    EXPECT_EQ(empty.vcount(), 0);
+
+    raiigraph::Graph graph(10);
+    auto snapshot = graph.adjacency_snapshot();
+    EXPECT_EQ(snapshot.vcount(), 10);
+    EXPECT_EQ(snapshot.degree(5), 0);
+    EXPECT_TRUE(snapshot.neighbors(5).empty());
+}
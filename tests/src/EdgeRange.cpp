@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/Graph.hpp"
+#include "raiigraph/EdgeRange.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/parallelize.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+TEST(EdgeRange, Basic) {
+    raiigraph::initialize();
+
+    std::mt19937_64 rng(42);
+    std::vector<igraph_int_t> edges;
+    for (int e = 0; e < 500; ++e) {
+        edges.push_back(rng() % 100);
+        edges.push_back(rng() % 100);
+    }
+
+    for (bool directed : { true, false }) {
+        raiigraph::Graph graph(raiigraph::IntVectorView(edges), 100, directed);
+        auto range = graph.edges();
+        EXPECT_EQ(range.size(), 500);
+        EXPECT_FALSE(range.empty());
+
+        // Consistent with igraph_edge().
+        igraph_int_t counter = 0;
+        for (auto edge : range) {
+            EXPECT_EQ(edge.id, counter);
+            igraph_int_t from, to;
+            igraph_edge(graph, counter, &from, &to);
+            EXPECT_EQ(edge.from, from);
+            EXPECT_EQ(edge.to, to);
+            if (!directed) {
+                EXPECT_LE(edge.from, edge.to);
+            }
+            ++counter;
+        }
+        EXPECT_EQ(counter, 500);
+
+        EXPECT_EQ(range[10].from, (*(range.begin() + 10)).from);
+        EXPECT_EQ(range.end() - range.begin(), 500);
+        EXPECT_EQ(range.from_data()[20], range[20].from);
+        EXPECT_EQ(range.to_data()[20], range[20].to);
+
+        // Sub-ranges can be processed in parallel.
+        std::vector<igraph_int_t> degree(100);
+        std::vector<std::vector<igraph_int_t> > partial(3, std::vector<igraph_int_t>(100));
+        raiigraph::parallelize(3, range.size(), [&](int t, igraph_int_t start, igraph_int_t length) -> void {
+            for (auto edge : range.subrange(start, length)) {
+                ++partial[t][edge.from];
+            }
+        });
+        for (const auto& p : partial) {
+            for (int v = 0; v < 100; ++v) {
+                degree[v] += p[v];
+            }
+        }
+        std::vector<igraph_int_t> expected(100);
+        for (auto edge : range) {
+            ++expected[edge.from];
+        }
+        EXPECT_EQ(degree, expected);
+
+        auto sub = range.subrange(100, 50);
+        EXPECT_EQ(sub.size(), 50);
+        EXPECT_EQ(sub[0].id, 100);
+        EXPECT_EQ((*(sub.end() - 1)).id, 149);
+    }
+
+    // Empty and moved-from graphs.
+    raiigraph::Graph empty(10);
+    EXPECT_TRUE(empty.edges().empty());
+    raiigraph::Graph other(std::move(empty));
+    EXPECT_TRUE(empty.edges().empty());
+}
@@ -1,9 +1,14 @@
 #include <gtest/gtest.h>
 
 #include "raiigraph/Graph.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/Matrix.hpp"
+#include "raiigraph/parallelize.hpp"
 #include "raiigraph/initialize.hpp"
 
 #include <random>
+#include <vector>
+#include <algorithm>
 
 TEST(Graph, Basic) {
     raiigraph::initialize();
@@ -34,6 +39,24 @@ TEST(Graph, Basic) {
     EXPECT_FALSE(graph.get() == NULL);
     EXPECT_FALSE(const_cast<const raiigraph::Graph*>(&graph)->get() == NULL);
 
+    // Extracting the edge list, with and without re-using memory.
+    {
+        auto el = graph.get_edgelist();
+        EXPECT_EQ(std::vector<igraph_int_t>(el.begin(), el.end()), edges);
+
+        raiigraph::IntVector reused(edges.size() * 2);
+        auto ptr = reused.data();
+        graph.get_edgelist(reused);
+        EXPECT_EQ(std::vector<igraph_int_t>(reused.begin(), reused.end()), edges);
+        EXPECT_EQ(reused.data(), ptr);
+
+        graph.get_edgelist(reused, true);
+        EXPECT_EQ(reused.size(), edges.size());
+        EXPECT_EQ(reused[0], edges[0]);
+        EXPECT_EQ(reused[nedges], edges[1]);
+        EXPECT_EQ(reused.data(), ptr);
+    }
+
     // Trying copy construction/assignment to get some coverage.
     {
         raiigraph::Graph g2(graph);
@@ -75,6 +98,149 @@ TEST(Graph, Basic) {
     }
 }
 
+TEST(Graph, VectorView) {
+    std::vector<igraph_integer_t> edges { 0, 1, 1, 2, 2, 3, 4, 0 };
+    raiigraph::IntVectorView edge_view(edges);
+
+    raiigraph::Graph graph(edge_view, 5, IGRAPH_DIRECTED);
+    EXPECT_EQ(graph.is_directed(), IGRAPH_DIRECTED);
+    EXPECT_EQ(graph.ecount(), 4);
+    EXPECT_EQ(graph.vcount(), 5);
+
+    auto el = graph.get_edgelist();
+    EXPECT_EQ(std::vector<igraph_int_t>(el.begin(), el.end()), edges);
+}
+
+TEST(Graph, Move) {
+    raiigraph::initialize();
+
+    static_assert(std::is_nothrow_move_constructible<raiigraph::Graph>::value);
+    static_assert(std::is_nothrow_move_assignable<raiigraph::Graph>::value);
+
+    std::vector<igraph_int_t> raw_edges{ 0, 1, 1, 2, 2, 3 };
+    raiigraph::IntVector edges(raw_edges.begin(), raw_edges.end());
+    raiigraph::Graph graph(edges, 4, IGRAPH_DIRECTED);
+    auto ptr = graph.get()->from.stor_begin;
+
+    raiigraph::Graph moved(std::move(graph));
+    EXPECT_EQ(moved.get()->from.stor_begin, ptr); // no reallocation.
+    EXPECT_EQ(moved.vcount(), 4);
+    EXPECT_EQ(moved.ecount(), 3);
+    EXPECT_TRUE(moved.is_directed());
+
+    // Moved-from graph is empty and undirected.
+    EXPECT_EQ(graph.vcount(), 0);
+    EXPECT_EQ(graph.ecount(), 0);
+    EXPECT_FALSE(graph.is_directed());
+
+    // Moved-from graph is re-initialized when passed to igraph.
+    {
+        raiigraph::Graph other(std::move(graph));
+        EXPECT_FALSE(graph.get() == NULL);
+        EXPECT_EQ(igraph_vcount(graph), 0);
+        EXPECT_EQ(igraph_ecount(graph), 0);
+        EXPECT_EQ(graph.get_edgelist().size(), 0);
+    }
+
+    // Const access to a moved-from graph does not re-initialize it.
+    {
+        raiigraph::Graph other(std::move(moved));
+        raiigraph::Graph other2(std::move(other));
+        raiigraph::Graph other3(std::move(other2));
+        const auto& cref = other;
+        const auto& cref2 = other2;
+        EXPECT_FALSE(cref.get() == NULL);
+        EXPECT_EQ(cref.get(), cref2.get()); // both refer to the same empty placeholder.
+        EXPECT_EQ(igraph_vcount(cref), 0);
+
+        // Const queries on the shared placeholder can be made from multiple threads.
+        std::vector<char> loops(4, true), multiple(4, true);
+        raiigraph::parallelize(4, 4, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t t = start, end = start + length; t < end; ++t) {
+                const auto& target = (t % 2 ? cref : cref2);
+                loops[t] = target.has_loop();
+                multiple[t] = target.has_multiple();
+            }
+        });
+        EXPECT_EQ(loops, std::vector<char>(4, false));
+        EXPECT_EQ(multiple, std::vector<char>(4, false));
+
+        raiigraph::Graph copy(cref);
+        EXPECT_EQ(copy.vcount(), 0);
+        EXPECT_EQ(copy.ecount(), 0);
+        moved = std::move(other3);
+    }
+
+    // Moved-from graph can be assigned to.
+    {
+        raiigraph::Graph other(std::move(moved));
+        moved = other;
+        EXPECT_EQ(moved.vcount(), 4);
+        EXPECT_EQ(moved.ecount(), 3);
+
+        raiigraph::Graph other2(std::move(other));
+        other = std::move(other2);
+        EXPECT_EQ(other.ecount(), 3);
+    }
+
+    // Growth of a std::vector moves rather than copies.
+    {
+        std::vector<raiigraph::Graph> collection;
+        std::vector<const igraph_int_t*> pointers;
+        for (int i = 0; i < 50; ++i) {
+            collection.emplace_back(edges, 4 + i, IGRAPH_UNDIRECTED);
+            pointers.push_back(collection.back().get()->from.stor_begin);
+        }
+
+        for (int i = 0; i < 50; ++i) {
+            EXPECT_EQ(collection[i].get()->from.stor_begin, pointers[i]);
+            EXPECT_EQ(collection[i].vcount(), 4 + i);
+        }
+    }
+}
+
+TEST(Graph, CopyAssignment) {
+    raiigraph::initialize();
+
+    std::vector<igraph_int_t> raw_small{ 0, 1, 1, 2 };
+    raiigraph::IntVector small_edges(raw_small.begin(), raw_small.end());
+    raiigraph::Graph small(small_edges, 3, IGRAPH_UNDIRECTED);
+
+    std::vector<igraph_int_t> raw_large{ 0, 1, 1, 2, 2, 3, 3, 4, 4, 0 };
+    raiigraph::IntVector large_edges(raw_large.begin(), raw_large.end());
+    raiigraph::Graph large(large_edges, 6, IGRAPH_DIRECTED);
+
+    raiigraph::Graph target(large);
+    auto from_ptr = target.get()->from.stor_begin;
+    auto oi_ptr = target.get()->oi.stor_begin;
+
+    // Repeated assignment re-uses the existing storage.
+    for (int it = 0; it < 10; ++it) {
+        target = small;
+        EXPECT_EQ(target.vcount(), 3);
+        EXPECT_EQ(target.ecount(), 2);
+        EXPECT_FALSE(target.is_directed());
+        auto el = target.get_edgelist();
+        EXPECT_EQ(std::vector<igraph_int_t>(el.begin(), el.end()), raw_small);
+
+        target = large;
+        EXPECT_EQ(target.vcount(), 6);
+        EXPECT_EQ(target.ecount(), 5);
+        EXPECT_TRUE(target.is_directed());
+        el = target.get_edgelist();
+        EXPECT_EQ(std::vector<igraph_int_t>(el.begin(), el.end()), raw_large);
+
+        EXPECT_EQ(target.get()->from.stor_begin, from_ptr);
+        EXPECT_EQ(target.get()->oi.stor_begin, oi_ptr);
+    }
+
+    // Assignment to a moved-from graph works.
+    raiigraph::Graph other(std::move(target));
+    target = small;
+    EXPECT_EQ(target.vcount(), 3);
+    EXPECT_EQ(target.ecount(), 2);
+}
+
 TEST(Graph, Coercion) {
     raiigraph::initialize();
 
@@ -116,3 +282,101 @@ TEST(Graph, Methods) {
     EXPECT_EQ(edges2[3], 3);
     EXPECT_EQ(edges2.back(), 2);
 }
+
+static void compare_internals(const raiigraph::Graph& left, const raiigraph::Graph& right) {
+    const igraph_t* lptr = left.get();
+    const igraph_t* rptr = right.get();
+    EXPECT_EQ(lptr->n, rptr->n);
+    EXPECT_EQ(lptr->directed, rptr->directed);
+    for (auto m : { &igraph_t::from, &igraph_t::to, &igraph_t::oi, &igraph_t::ii, &igraph_t::os, &igraph_t::is }) {
+        const auto& lvec = lptr->*m;
+        const auto& rvec = rptr->*m;
+        EXPECT_EQ(std::vector<igraph_int_t>(lvec.stor_begin, lvec.end), std::vector<igraph_int_t>(rvec.stor_begin, rvec.end));
+    }
+}
+
+TEST(Graph, FromNeighbors) {
+    raiigraph::initialize();
+
+    igraph_int_t nobs = 50, k = 4;
+    std::mt19937_64 rng(42);
+    raiigraph::IntMatrix neighbors(nobs, k);
+    for (igraph_int_t i = 0; i < nobs; ++i) {
+        std::vector<igraph_int_t> chosen;
+        while (static_cast<igraph_int_t>(chosen.size()) < k) {
+            igraph_int_t candidate = (i + nobs - 5 + rng() % 11) % nobs; // small window to get plenty of reciprocal neighbors.
+            if (candidate != i && std::find(chosen.begin(), chosen.end(), candidate) == chosen.end()) {
+                chosen.push_back(candidate);
+            }
+        }
+        for (igraph_int_t r = 0; r < k; ++r) {
+            neighbors(i, r) = chosen[r];
+        }
+    }
+
+    auto is_neighbor = [&](igraph_int_t i, igraph_int_t n) -> bool {
+        for (igraph_int_t r = 0; r < k; ++r) {
+            if (neighbors(i, r) == n) {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    for (int nthreads : { 1, 3 }) {
+        for (bool directed : { true, false }) {
+            raiigraph::IntVector edges;
+            for (igraph_int_t i = 0; i < nobs; ++i) {
+                for (igraph_int_t r = 0; r < k; ++r) {
+                    edges.push_back(i);
+                    edges.push_back(neighbors(i, r));
+                }
+            }
+            raiigraph::Graph ref(edges, nobs, directed);
+            auto graph = raiigraph::Graph::from_neighbors(neighbors, directed, raiigraph::SymmetrizeMode::NONE, nthreads);
+            compare_internals(graph, ref);
+        }
+
+        for (auto mode : { raiigraph::SymmetrizeMode::UNION, raiigraph::SymmetrizeMode::INTERSECTION }) {
+            raiigraph::IntVector edges;
+            igraph_int_t nreciprocal = 0;
+            for (igraph_int_t i = 0; i < nobs; ++i) {
+                for (igraph_int_t r = 0; r < k; ++r) {
+                    auto n = neighbors(i, r);
+                    bool reciprocal = is_neighbor(n, i);
+                    if ((reciprocal && i < n) || (!reciprocal && mode == raiigraph::SymmetrizeMode::UNION)) {
+                        edges.push_back(i);
+                        edges.push_back(n);
+                    }
+                    nreciprocal += reciprocal;
+                }
+            }
+            EXPECT_GT(nreciprocal, 0);
+
+            raiigraph::Graph ref(edges, nobs, false);
+            auto graph = raiigraph::Graph::from_neighbors(neighbors, false, mode, nthreads);
+            compare_internals(graph, ref);
+            EXPECT_FALSE(graph.has_multiple());
+        }
+    }
+
+    // Empty inputs and errors.
+    raiigraph::IntMatrix empty(10, 0);
+    auto graph = raiigraph::Graph::from_neighbors(empty, false, raiigraph::SymmetrizeMode::UNION);
+    EXPECT_EQ(graph.vcount(), 10);
+    EXPECT_EQ(graph.ecount(), 0);
+
+    EXPECT_ANY_THROW(raiigraph::Graph::from_neighbors(neighbors, true, raiigraph::SymmetrizeMode::UNION));
+    auto original = neighbors(0, 0);
+    neighbors(0, 0) = nobs;
+    EXPECT_ANY_THROW(raiigraph::Graph::from_neighbors(neighbors, false));
+
+    // Self-neighbors are rejected in all modes.
+    neighbors(0, 0) = original;
+    EXPECT_NO_THROW(raiigraph::Graph::from_neighbors(neighbors, false));
+    neighbors(7, 2) = 7;
+    EXPECT_ANY_THROW(raiigraph::Graph::from_neighbors(neighbors, true));
+    for (auto mode : { raiigraph::SymmetrizeMode::NONE, raiigraph::SymmetrizeMode::UNION, raiigraph::SymmetrizeMode::INTERSECTION }) {
+        EXPECT_ANY_THROW(raiigraph::Graph::from_neighbors(neighbors, false, mode));
+    }
+}
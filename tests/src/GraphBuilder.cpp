@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/GraphBuilder.hpp"
+#include "raiigraph/Graph.hpp"
+#include "raiigraph/parallelize.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <set>
+
+static std::vector<igraph_int_t> simulate_edges(igraph_int_t nvertices, igraph_int_t nedges, int seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<igraph_int_t> edges;
+    for (igraph_int_t e = 0; e < nedges; ++e) {
+        edges.push_back(rng() % nvertices);
+        edges.push_back(rng() % nvertices); // includes self-loops and multi-edges.
+    }
+    return edges;
+}
+
+static std::vector<igraph_int_t> get_edges(const raiigraph::Graph& graph) {
+    std::vector<igraph_int_t> output;
+    for (auto edge : graph.edges()) {
+        output.push_back(edge.from);
+        output.push_back(edge.to);
+    }
+    return output;
+}
+
+TEST(GraphBuilder, Basic) {
+    raiigraph::initialize();
+    auto edges = simulate_edges(50, 1000, 42);
+
+    for (bool directed : { true, false }) {
+        raiigraph::Graph ref(raiigraph::IntVectorView(edges), 50, directed);
+
+        // Single worker, with small chunks to check that edges are carried across chunks.
+        raiigraph::GraphBuilder builder(50, directed, 1, 7);
+        for (std::size_t i = 0; i < edges.size(); i += 2) {
+            builder.add_edge(0, edges[i], edges[i + 1]);
+        }
+        EXPECT_EQ(builder.num_edges(), 1000);
+        auto graph = builder.build();
+        EXPECT_EQ(graph.vcount(), 50);
+        EXPECT_EQ(graph.is_directed(), directed);
+        EXPECT_EQ(get_edges(graph), get_edges(ref));
+
+        // Builder can be re-used.
+        EXPECT_EQ(builder.num_edges(), 0);
+        builder.add_edges(0, edges.data(), 10);
+        EXPECT_EQ(builder.build().ecount(), 10);
+    }
+}
+
+TEST(GraphBuilder, Parallel) {
+    raiigraph::initialize();
+    auto edges = simulate_edges(50, 1000, 69);
+
+    for (int nthreads : { 1, 3 }) {
+        raiigraph::GraphBuilder builder(50, true, 4, 13);
+        raiigraph::parallelize(4, 1000, [&](int w, igraph_int_t start, igraph_int_t length) -> void {
+            builder.add_edges(w, edges.data() + 2 * start, length);
+        });
+        EXPECT_EQ(builder.num_workers(), 4);
+
+        // Workers are filled in order of their ranges, so the edge order is preserved.
+        auto graph = builder.build(false, false, nthreads);
+        EXPECT_EQ(get_edges(graph), edges);
+    }
+}
+
+TEST(GraphBuilder, Simplify) {
+    raiigraph::initialize();
+    auto edges = simulate_edges(20, 500, 100);
+
+    for (bool directed : { true, false }) {
+        for (int nthreads : { 1, 3 }) {
+            raiigraph::GraphBuilder builder(20, directed, 2, 11);
+            for (std::size_t i = 0; i < edges.size(); i += 2) {
+                builder.add_edge(i % 4 == 0, edges[i], edges[i + 1]);
+            }
+            auto noloops = builder.build(true, false, nthreads);
+            for (auto edge : noloops.edges()) {
+                EXPECT_NE(edge.from, edge.to);
+            }
+            igraph_int_t nloops = 0;
+            for (std::size_t i = 0; i < edges.size(); i += 2) {
+                nloops += (edges[i] == edges[i + 1]);
+            }
+            EXPECT_EQ(noloops.ecount(), 500 - nloops);
+
+            for (bool remove_loops : { false, true }) {
+                for (std::size_t i = 0; i < edges.size(); i += 2) {
+                    builder.add_edge(i % 4 == 0, edges[i], edges[i + 1]);
+                }
+                auto simple = builder.build(remove_loops, true, nthreads);
+
+                std::set<std::pair<igraph_int_t, igraph_int_t> > expected;
+                for (std::size_t i = 0; i < edges.size(); i += 2) {
+                    auto from = edges[i], to = edges[i + 1];
+                    if (remove_loops && from == to) {
+                        continue;
+                    }
+                    if (!directed && from > to) {
+                        std::swap(from, to);
+                    }
+                    expected.emplace(from, to);
+                }
+
+                std::vector<igraph_int_t> expected_edges;
+                for (const auto& e : expected) {
+                    expected_edges.push_back(e.first);
+                    expected_edges.push_back(e.second);
+                }
+                EXPECT_EQ(get_edges(simple), expected_edges);
+            }
+        }
+    }
+}
+
+TEST(GraphBuilder, Errors) {
+    raiigraph::initialize();
+    EXPECT_ANY_THROW(raiigraph::GraphBuilder(-1, false));
+    EXPECT_ANY_THROW(raiigraph::GraphBuilder(10, false, 1, 0));
+
+    raiigraph::GraphBuilder builder(10, false);
+    EXPECT_ANY_THROW(builder.add_edge(0, 10, 0));
+    EXPECT_ANY_THROW(builder.add_edge(0, 0, -1));
+
+    auto empty = builder.build();
+    EXPECT_EQ(empty.vcount(), 10);
+    EXPECT_EQ(empty.ecount(), 0);
+}
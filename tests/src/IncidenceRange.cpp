@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/Graph.hpp"
+#include "raiigraph/IncidenceRange.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+
+class IncidenceRangeTest : public ::testing::TestWithParam<std::tuple<bool, igraph_neimode_t, igraph_loops_t> > {};
+
+TEST_P(IncidenceRangeTest, Basic) {
+    raiigraph::initialize();
+
+    auto param = GetParam();
+    bool directed = std::get<0>(param);
+    auto mode = std::get<1>(param);
+    auto loops = std::get<2>(param);
+
+    igraph_int_t nvertices = 50;
+    std::mt19937_64 rng(42);
+    std::vector<igraph_int_t> edges;
+    for (int e = 0; e < 200; ++e) {
+        edges.push_back(rng() % nvertices);
+        edges.push_back(rng() % nvertices); // includes self-loops and multi-edges.
+    }
+    raiigraph::Graph graph(raiigraph::IntVectorView(edges), nvertices, directed);
+
+    // Comparing to the adjacency snapshot, which is tested against a brute-force reference.
+    auto snapshot = graph.adjacency_snapshot(mode, loops, true);
+
+    for (igraph_int_t v = 0; v < nvertices; ++v) {
+        auto nrange = graph.neighbors(v, mode, loops);
+        std::vector<igraph_int_t> neighbors(nrange.begin(), nrange.end());
+        auto expected_neighbors = snapshot.neighbors(v);
+        EXPECT_EQ(neighbors, std::vector<igraph_int_t>(expected_neighbors.begin(), expected_neighbors.end()));
+        EXPECT_EQ(nrange.empty(), neighbors.empty());
+
+        auto erange = graph.incident(v, mode, loops);
+        std::vector<igraph_int_t> incident(erange.begin(), erange.end());
+        auto expected_incident = snapshot.edges(v);
+        EXPECT_EQ(incident, std::vector<igraph_int_t>(expected_incident.begin(), expected_incident.end()));
+
+        // Each incident edge connects 'v' to the corresponding neighbor.
+        for (size_t i = 0; i < incident.size(); ++i) {
+            igraph_int_t from, to;
+            igraph_edge(graph, incident[i], &from, &to);
+            EXPECT_TRUE((from == v && to == neighbors[i]) || (to == v && from == neighbors[i]));
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    IncidenceRange,
+    IncidenceRangeTest,
+    ::testing::Combine(
+        ::testing::Values(true, false),
+        ::testing::Values(IGRAPH_OUT, IGRAPH_IN, IGRAPH_ALL),
+        ::testing::Values(IGRAPH_NO_LOOPS, IGRAPH_LOOPS_ONCE, IGRAPH_LOOPS_TWICE)
+    )
+);
+
+TEST(IncidenceRange, Iterator) {
+    raiigraph::initialize();
+
+    std::vector<igraph_int_t> edges { 0, 1, 0, 2, 0, 0, 3, 0 };
+    raiigraph::Graph graph(raiigraph::IntVectorView(edges), 4, true);
+
+    auto range = graph.neighbors(0, IGRAPH_ALL);
+    auto it = range.begin();
+    EXPECT_EQ(*it, 0);
+    EXPECT_EQ(*(it++), 0);
+    EXPECT_EQ(*it, 0); // self-loop is reported twice.
+    ++it;
+    EXPECT_EQ(*it, 1);
+    ++it;
+    EXPECT_EQ(*it, 2);
+    ++it;
+    EXPECT_EQ(*it, 3);
+    ++it;
+    EXPECT_TRUE(it == range.end());
+
+    EXPECT_EQ(std::vector<igraph_int_t>(graph.incident(0, IGRAPH_OUT, IGRAPH_NO_LOOPS).begin(), graph.incident(0, IGRAPH_OUT, IGRAPH_NO_LOOPS).end()), std::vector<igraph_int_t>({ 0, 1 }));
+    EXPECT_TRUE(graph.neighbors(1).empty());
+    EXPECT_FALSE(graph.neighbors(1, IGRAPH_IN).empty());
+
+    EXPECT_ANY_THROW(graph.neighbors(0, static_cast<igraph_neimode_t>(0)));
+}
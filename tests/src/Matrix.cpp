@@ -4,6 +4,7 @@
 #include "raiigraph/initialize.hpp"
 
 #include <random>
+#include <numeric>
 
 TEST(Matrix, Construction) {
     raiigraph::initialize();
@@ -96,6 +97,136 @@ TEST(Matrix, Resize) {
     EXPECT_EQ(contents.back(), 1);
 }
 
+static void check_preserved(const raiigraph::IntMatrix& mat, igraph_int_t old_nr, igraph_int_t old_nc, igraph_int_t fill) {
+    for (igraph_int_t c = 0; c < mat.ncol(); ++c) {
+        for (igraph_int_t r = 0; r < mat.nrow(); ++r) {
+            if (r < old_nr && c < old_nc) {
+                EXPECT_EQ(mat(r, c), r * 1000 + c);
+            } else {
+                EXPECT_EQ(mat(r, c), fill);
+            }
+        }
+    }
+}
+
+TEST(Matrix, ResizePreserve) {
+    raiigraph::initialize();
+
+    auto create = [](igraph_int_t nr, igraph_int_t nc) -> raiigraph::IntMatrix {
+        raiigraph::IntMatrix mat(nr, nc);
+        for (igraph_int_t c = 0; c < nc; ++c) {
+            for (igraph_int_t r = 0; r < nr; ++r) {
+                mat(r, c) = r * 1000 + c;
+            }
+        }
+        return mat;
+    };
+
+    for (auto dims : std::vector<std::pair<int, int> >{ { 5, 7 }, { 10, 7 }, { 3, 7 }, { 5, 10 }, { 5, 2 }, { 12, 3 }, { 2, 12 }, { 0, 4 }, { 5, 0 } }) {
+        auto mat = create(5, 7);
+        mat.resize_preserve(dims.first, dims.second, -1);
+        EXPECT_EQ(mat.nrow(), dims.first);
+        EXPECT_EQ(mat.ncol(), dims.second);
+        check_preserved(mat, 5, 7, -1);
+    }
+
+    // Re-uses the existing allocation if possible.
+    {
+        auto mat = create(10, 10);
+        auto ptr = mat.data();
+        mat.resize_preserve(5, 10);
+        EXPECT_EQ(mat.data(), ptr);
+        mat.resize_preserve(10, 10, -2);
+        EXPECT_EQ(mat.data(), ptr);
+        check_preserved(mat, 5, 10, -2);
+    }
+
+    // Works from a moved-from matrix.
+    {
+        auto mat = create(2, 2);
+        auto other = std::move(mat);
+        mat.resize_preserve(3, 4, 0);
+        EXPECT_EQ(mat.size(), 12);
+    }
+
+    auto mat = create(1, 1);
+    EXPECT_THROW(mat.resize_preserve(-1, 5), raiigraph::IgraphError);
+}
+
+TEST(Matrix, AddRowsCols) {
+    raiigraph::initialize();
+
+    raiigraph::IntMatrix mat(3, 4);
+    for (igraph_int_t c = 0; c < 4; ++c) {
+        for (igraph_int_t r = 0; r < 3; ++r) {
+            mat(r, c) = r * 1000 + c;
+        }
+    }
+
+    mat.add_rows(2, -1);
+    EXPECT_EQ(mat.nrow(), 5);
+    check_preserved(mat, 3, 4, -1);
+
+    mat.add_cols(3, -1);
+    EXPECT_EQ(mat.ncol(), 7);
+    check_preserved(mat, 3, 4, -1);
+
+    // Geometric growth of the capacity.
+    int reallocations = 0;
+    auto ptr = mat.data();
+    for (int i = 0; i < 1000; ++i) {
+        mat.add_cols(1, -1);
+        if (mat.data() != ptr) {
+            ++reallocations;
+            ptr = mat.data();
+        }
+    }
+    EXPECT_EQ(mat.ncol(), 1007);
+    EXPECT_LT(reallocations, 20);
+    check_preserved(mat, 3, 4, -1);
+
+    for (int i = 0; i < 100; ++i) {
+        mat.add_rows(1, -1);
+    }
+    EXPECT_EQ(mat.nrow(), 105);
+    check_preserved(mat, 3, 4, -1);
+
+    raiigraph::IntMatrix empty;
+    empty.reserve(100);
+    EXPECT_GE(empty.capacity(), 100);
+    auto eptr = empty.data();
+    empty.add_cols(10);
+    empty.add_rows(10, 5);
+    EXPECT_EQ(empty.data(), eptr);
+    EXPECT_EQ(empty(9, 9), 5);
+}
+
+TEST(Matrix, Uninitialized) {
+    raiigraph::initialize();
+
+    raiigraph::RealMatrix contents(10, 20, raiigraph::uninitialized);
+    EXPECT_EQ(contents.nrow(), 10);
+    EXPECT_EQ(contents.ncol(), 20);
+    EXPECT_EQ(contents.size(), 200);
+    std::iota(contents.begin(), contents.end(), 0);
+    EXPECT_EQ(contents(9, 19), 199);
+
+    contents.resize_uninitialized(20, 20);
+    EXPECT_EQ(contents.size(), 400);
+    EXPECT_EQ(contents[199], 199);
+
+    // end() respects the size after shrinking.
+    contents.resize_uninitialized(5, 5);
+    EXPECT_EQ(contents.end() - contents.begin(), 25);
+    EXPECT_EQ(contents.back(), 24);
+
+    raiigraph::IntMatrix empty(0, 10, raiigraph::uninitialized);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.ncol(), 10);
+
+    EXPECT_THROW(raiigraph::IntMatrix(-1, 10, raiigraph::uninitialized), raiigraph::IgraphError);
+}
+
 TEST(Matrix, Access1D) {
     raiigraph::initialize();
 
@@ -183,6 +314,9 @@ TEST(Matrix, AccessRow) {
     raiigraph::IntegerMatrix contents(10, 20); 
     std::iota(contents.begin(), contents.end(), 0); // column-major filling.
     const auto& const_contents = contents;
+    raiigraph::IntVector reused;
+    reused.reserve(20);
+    auto reused_ptr = reused.data();
 
     for (int i = 0; i < 10; ++i) {
         // Checking a simple copy.
@@ -190,6 +324,13 @@ TEST(Matrix, AccessRow) {
         EXPECT_EQ(copy.front(), i);
         EXPECT_EQ(copy.back(), i + 190);
 
+        // Checking a copy into an existing vector, which should not reallocate.
+        contents.row_copy(i, reused);
+        EXPECT_EQ(reused.size(), 20);
+        EXPECT_EQ(reused.front(), i);
+        EXPECT_EQ(reused.back(), i + 190);
+        EXPECT_EQ(reused.data(), reused_ptr);
+
         // Checking the views.
         auto row = contents.row(i);
         EXPECT_EQ(row.size(), 20);
@@ -293,11 +434,20 @@ TEST(Matrix, AccessColumn) {
     std::iota(contents.begin(), contents.end(), 0); // column-major filling.
     const auto& const_contents = contents;
 
+    raiigraph::IntVector reused(100); // more than enough capacity.
+    auto reused_ptr = reused.data();
+
     for (int j = 0; j < 20; ++j) {
         auto copy = contents.column_copy(j);
         EXPECT_EQ(copy.front(), j * 10);
         EXPECT_EQ(copy.back(), j * 10 + 9);
 
+        contents.column_copy(j, reused);
+        EXPECT_EQ(reused.size(), 10);
+        EXPECT_EQ(reused.front(), j * 10);
+        EXPECT_EQ(reused.back(), j * 10 + 9);
+        EXPECT_EQ(reused.data(), reused_ptr);
+
         // Checking the views.
         auto row = contents.column(j);
         EXPECT_EQ(row.size(), 10);
@@ -327,6 +477,133 @@ TEST(Matrix, AccessColumn) {
     }
 }
 
+TEST(Matrix, Block) {
+    raiigraph::initialize();
+
+    raiigraph::IntMatrix contents(10, 20);
+    std::iota(contents.begin(), contents.end(), 0);
+
+    auto blk = contents.block(2, 3, 5, 4);
+    EXPECT_EQ(blk.nrow(), 5);
+    EXPECT_EQ(blk.ncol(), 4);
+    EXPECT_EQ(blk.size(), 20);
+    EXPECT_FALSE(blk.empty());
+    EXPECT_EQ(blk.leading_dimension(), 10);
+    EXPECT_EQ(blk(0, 0), contents(2, 3));
+    EXPECT_EQ(blk(4, 3), contents(6, 6));
+
+    // Columns are contiguous.
+    auto col = blk.column_data(2);
+    EXPECT_EQ(col, contents.data() + 2 + 5 * 10);
+    EXPECT_EQ(col[4], contents(6, 5));
+    auto cview = blk.column(1);
+    EXPECT_EQ(cview.size(), 5);
+    EXPECT_EQ(cview.back(), contents(6, 4));
+
+    auto rview = blk.row(1);
+    EXPECT_EQ(rview.size(), 4);
+    EXPECT_EQ(rview.front(), contents(3, 3));
+    EXPECT_EQ(rview.back(), contents(3, 6));
+
+    // Modifications are propagated to the parent.
+    blk(1, 1) = -1;
+    EXPECT_EQ(contents(3, 4), -1);
+    std::fill(blk.column(0).begin(), blk.column(0).end(), -2);
+    EXPECT_EQ(contents(6, 3), -2);
+    EXPECT_EQ(contents(7, 3), 7 + 3 * 10);
+
+    // Sub-blocks.
+    auto sub = blk.block(1, 1, 2, 2);
+    EXPECT_EQ(sub(0, 0), -1);
+    EXPECT_EQ(sub(1, 1), contents(4, 5));
+    EXPECT_THROW(blk.block(4, 0, 2, 1), raiigraph::IgraphError);
+    EXPECT_THROW(contents.block(0, 19, 1, 2), raiigraph::IgraphError);
+    EXPECT_THROW(contents.block(-1, 0, 1, 1), raiigraph::IgraphError);
+
+    const auto& const_contents = contents;
+    auto cblk = const_contents.block(0, 0, 10, 20);
+    EXPECT_EQ(cblk(9, 19), contents.back());
+    EXPECT_TRUE(const_contents.block(10, 20, 0, 0).empty());
+}
+
+TEST(Matrix, BlockTiles) {
+    raiigraph::initialize();
+
+    raiigraph::RealMatrix contents(23, 17);
+    std::iota(contents.begin(), contents.end(), 0);
+    raiigraph::RealMatrix visited(23, 17);
+
+    auto blk = contents.block(0, 0, 23, 17);
+    int ntiles = 0;
+    blk.for_each_tile(8, 5, [&](igraph_int_t r0, igraph_int_t c0, const auto& tile) -> void {
+        EXPECT_LE(tile.nrow(), 8);
+        EXPECT_LE(tile.ncol(), 5);
+        for (igraph_int_t c = 0; c < tile.ncol(); ++c) {
+            auto ptr = tile.column_data(c);
+            for (igraph_int_t r = 0; r < tile.nrow(); ++r) {
+                EXPECT_EQ(ptr[r], contents(r0 + r, c0 + c));
+                visited(r0 + r, c0 + c) += 1;
+            }
+        }
+        ++ntiles;
+    });
+
+    EXPECT_EQ(ntiles, 3 * 4);
+    EXPECT_TRUE(std::all_of(visited.begin(), visited.end(), [](double x) -> bool { return x == 1; }));
+    EXPECT_THROW(blk.for_each_tile(0, 5, [](igraph_int_t, igraph_int_t, const auto&) -> void {}), raiigraph::IgraphError);
+}
+
+TEST(Matrix, Transpose) {
+    raiigraph::initialize();
+
+    // Using dimensions that are not multiples of the tile size.
+    for (auto dims : std::vector<std::pair<int, int> >{ { 0, 5 }, { 1, 1 }, { 7, 3 }, { 100, 33 }, { 65, 130 } }) {
+        int nr = dims.first, nc = dims.second;
+        raiigraph::RealMatrix mat(nr, nc);
+        std::iota(mat.begin(), mat.end(), 0);
+
+        for (int nthreads : { 1, 3 }) {
+            auto tmat = mat.transpose(nthreads);
+            EXPECT_EQ(tmat.nrow(), nc);
+            EXPECT_EQ(tmat.ncol(), nr);
+
+            std::vector<double> buffer(mat.size());
+            mat.to_row_major(buffer.data(), nthreads);
+
+            for (int r = 0; r < nr; ++r) {
+                for (int c = 0; c < nc; ++c) {
+                    EXPECT_EQ(tmat(c, r), mat(r, c));
+                    EXPECT_EQ(buffer[r * nc + c], mat(r, c));
+                }
+            }
+        }
+    }
+
+    raiigraph::IntMatrix imat(50, 40);
+    std::iota(imat.begin(), imat.end(), 0);
+    auto timat = imat.transpose();
+    EXPECT_EQ(timat(39, 49), imat(49, 39));
+    EXPECT_EQ(timat.transpose().row_copy(5).back(), imat(5, 39));
+}
+
+TEST(Matrix, Release) {
+    raiigraph::initialize();
+
+    raiigraph::RealMatrix contents(5, 4);
+    std::iota(contents.begin(), contents.end(), 0);
+    auto ptr = contents.data();
+
+    auto [released, nr, nc] = contents.release();
+    EXPECT_EQ(released.get(), ptr); // no copy.
+    EXPECT_EQ(nr, 5);
+    EXPECT_EQ(nc, 4);
+    EXPECT_EQ(released[19], 19);
+
+    EXPECT_TRUE(contents.empty());
+    EXPECT_EQ(contents.nrow(), 0);
+    EXPECT_EQ(igraph_matrix_size(contents), 0);
+}
+
 TEST(Matrix, Coercion) {
     raiigraph::initialize();
 
@@ -350,6 +627,59 @@ TEST(Matrix, Swap) {
     EXPECT_EQ(contents2[0], 0);
 }
 
+TEST(Matrix, Move) {
+    raiigraph::initialize();
+
+    static_assert(std::is_nothrow_move_constructible<raiigraph::IntMatrix>::value);
+    static_assert(std::is_nothrow_move_assignable<raiigraph::IntMatrix>::value);
+
+    raiigraph::IntMatrix contents(10, 5, 1);
+    auto ptr = contents.data();
+    raiigraph::IntMatrix moved(std::move(contents));
+    EXPECT_EQ(moved.data(), ptr); // no reallocation.
+    EXPECT_EQ(moved.nrow(), 10);
+    EXPECT_EQ(moved.ncol(), 5);
+
+    // Moved-from matrix is empty and can still be used.
+    EXPECT_TRUE(contents.empty());
+    EXPECT_EQ(contents.nrow(), 0);
+    EXPECT_EQ(contents.ncol(), 0);
+    EXPECT_TRUE(contents.begin() == contents.end());
+    contents.resize(2, 3, 5);
+    EXPECT_EQ(contents.size(), 6);
+    EXPECT_EQ(contents(1, 2), 5);
+
+    {
+        raiigraph::IntMatrix other(std::move(contents));
+        EXPECT_FALSE(contents.get() == NULL);
+        EXPECT_EQ(igraph_matrix_int_size(contents), 0);
+
+        raiigraph::IntMatrix other2(std::move(other));
+        const auto& cref = other;
+        EXPECT_FALSE(cref.get() == NULL);
+        EXPECT_EQ(igraph_matrix_int_size(cref), 0);
+        EXPECT_TRUE(cref.data() == NULL); // const access does not re-initialize the matrix.
+
+        other = other2;
+        EXPECT_EQ(other.nrow(), 2);
+        EXPECT_EQ(other.ncol(), 3);
+    }
+
+    {
+        std::vector<raiigraph::IntMatrix> collection;
+        std::vector<const igraph_int_t*> pointers;
+        for (int i = 0; i < 100; ++i) {
+            collection.emplace_back(5, 2, i);
+            pointers.push_back(collection.back().data());
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(collection[i].data(), pointers[i]);
+            EXPECT_EQ(collection[i].front(), i);
+        }
+    }
+}
+
 TEST(Matrix, OtherTypes) {
     raiigraph::initialize();
 
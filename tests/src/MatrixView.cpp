@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/MatrixView.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <numeric>
+
+TEST(MatrixView, Construction) {
+    raiigraph::initialize();
+
+    raiigraph::IntMatrixView empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.nrow(), 0);
+    EXPECT_EQ(empty.ncol(), 0);
+    EXPECT_FALSE(empty.get() == NULL);
+
+    std::vector<igraph_real_t> values(20);
+    std::iota(values.begin(), values.end(), 0);
+
+    raiigraph::RealMatrixView view(values, 4, 5);
+    EXPECT_FALSE(view.empty());
+    EXPECT_EQ(view.nrow(), 4);
+    EXPECT_EQ(view.ncol(), 5);
+    EXPECT_EQ(view.size(), 20);
+    EXPECT_EQ(view.data(), values.data());
+    EXPECT_EQ(igraph_matrix_nrow(view), 4);
+    EXPECT_EQ(igraph_matrix_ncol(view), 5);
+    EXPECT_EQ(igraph_matrix_get(view, 1, 2), 9);
+
+    // Dimensions must match the container.
+    EXPECT_THROW(raiigraph::RealMatrixView(values, 4, 4), raiigraph::IgraphError);
+    EXPECT_THROW(raiigraph::RealMatrixView(values.data(), -1, 4), raiigraph::IgraphError);
+
+    // Works with raiigraph matrices.
+    raiigraph::IntMatrix mat(3, 2, 5);
+    raiigraph::IntMatrixView mview(mat);
+    EXPECT_EQ(mview.data(), mat.data());
+    EXPECT_EQ(mview.nrow(), 3);
+    EXPECT_EQ(mview.ncol(), 2);
+    EXPECT_EQ(mview(2, 1), 5);
+}
+
+TEST(MatrixView, Access) {
+    raiigraph::initialize();
+
+    std::vector<igraph_int_t> values(20);
+    std::iota(values.begin(), values.end(), 0);
+    raiigraph::IntMatrixView view(values.data(), 4, 5);
+
+    for (int c = 0; c < 5; ++c) {
+        for (int r = 0; r < 4; ++r) {
+            EXPECT_EQ(view(r, c), r + c * 4);
+            EXPECT_EQ(view[r + c * 4], r + c * 4);
+        }
+    }
+
+    EXPECT_EQ(view.front(), 0);
+    EXPECT_EQ(view.back(), 19);
+    EXPECT_EQ(view.end() - view.begin(), 20);
+    EXPECT_EQ(view.cend() - view.cbegin(), 20);
+    EXPECT_EQ(*(view.rbegin()), 19);
+    EXPECT_EQ(*(view.crend() - 1), 0);
+
+    auto row = view.row(1);
+    EXPECT_EQ(row.size(), 5);
+    EXPECT_EQ(row[0], 1);
+    EXPECT_EQ(row[4], 17);
+    EXPECT_EQ(std::accumulate(row.begin(), row.end(), 0), 1 + 5 + 9 + 13 + 17);
+
+    auto col = view.column(2);
+    EXPECT_EQ(col.size(), 4);
+    EXPECT_EQ(col.front(), 8);
+    EXPECT_EQ(col.back(), 11);
+
+    auto blk = view.block(1, 2, 3, 2);
+    EXPECT_EQ(blk(0, 0), 9);
+    EXPECT_EQ(blk(2, 1), 15);
+    EXPECT_EQ(blk.column_data(1), values.data() + 13);
+    EXPECT_THROW(view.block(2, 0, 3, 1), raiigraph::IgraphError);
+}
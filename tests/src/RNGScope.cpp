@@ -2,6 +2,9 @@
 
 #include "raiigraph/RNGScope.hpp"
 #include "raiigraph/initialize.hpp"
+#include "raiigraph/parallelize.hpp"
+
+#include <vector>
 
 TEST(RNGScope, Basic) {
     raiigraph::initialize();
@@ -58,3 +61,66 @@ TEST(RNGScope, Basic) {
         EXPECT_FALSE(first == first2 && second == second2);
     }
 }
+
+TEST(RNGScope, StreamFactory) {
+    raiigraph::initialize();
+
+    raiigraph::RNGStreamFactory factory(42);
+    EXPECT_EQ(factory.root_seed(), 42);
+    EXPECT_EQ(factory.type(), &igraph_rngtype_pcg32);
+    EXPECT_EQ(factory.seed(5), raiigraph::RNGStreamFactory(42).seed(5));
+    EXPECT_NE(factory.seed(5), factory.seed(6));
+    EXPECT_NE(factory.seed(5), raiigraph::RNGStreamFactory(43).seed(5));
+
+    // Adjacent roots should not yield shifted copies of the same streams.
+    raiigraph::RNGStreamFactory next(43);
+    for (igraph_uint_t s = 0; s < 100; ++s) {
+        EXPECT_NE(factory.seed(s + 1), next.seed(s));
+        EXPECT_NE(factory.seed(s), next.seed(s + 1));
+    }
+
+    // Same as using the derived seed directly.
+    int expected;
+    {
+        raiigraph::RNGScope scope(factory.seed(3));
+        expected = igraph_rng_get_integer(igraph_rng_default(), 0, 10000000);
+    }
+    {
+        raiigraph::RNGScope scope(factory, 3);
+        EXPECT_EQ(igraph_rng_get_integer(igraph_rng_default(), 0, 10000000), expected);
+    }
+
+    raiigraph::RNGStreamFactory factory64(42, &igraph_rngtype_pcg64);
+    EXPECT_EQ(factory64.type(), &igraph_rngtype_pcg64);
+    EXPECT_EQ(factory64.seed(3), factory.seed(3));
+}
+
+TEST(RNGScope, Threads) {
+    raiigraph::initialize();
+    if (!raiigraph::has_thread_local_rng()) {
+        return;
+    }
+
+    raiigraph::RNGStreamFactory factory(100);
+    igraph_int_t ntasks = 20, ndraws = 10;
+    auto run = [&](int nthreads) -> std::vector<igraph_int_t> {
+        std::vector<igraph_int_t> output(ntasks * ndraws);
+        raiigraph::parallelize(nthreads, ntasks, [&](int, igraph_int_t start, igraph_int_t length) -> void {
+            for (igraph_int_t t = start, end = start + length; t < end; ++t) {
+                raiigraph::RNGScope scope(factory, t);
+                for (igraph_int_t d = 0; d < ndraws; ++d) {
+                    output[t * ndraws + d] = igraph_rng_get_integer(igraph_rng_default(), 0, 10000000);
+                }
+            }
+        });
+        return output;
+    };
+
+    // Results do not depend on the number of threads.
+    auto ref = run(1);
+    EXPECT_EQ(ref, run(3));
+    EXPECT_EQ(ref, run(7));
+
+    // Streams differ from each other.
+    EXPECT_NE(std::vector<igraph_int_t>(ref.begin(), ref.begin() + ndraws), std::vector<igraph_int_t>(ref.begin() + ndraws, ref.begin() + 2 * ndraws));
+}
@@ -0,0 +1,227 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/SparseMatrix.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+
+static std::vector<double> densify(const raiigraph::CompressedSparseMatrix& mat) {
+    std::vector<double> output(mat.nrow() * mat.ncol());
+    const auto& p = mat.pointers();
+    const auto& i = mat.indices();
+    const auto& x = mat.values();
+    for (igraph_int_t m = 0; m + 1 < p.size(); ++m) {
+        for (igraph_int_t j = p[m]; j < p[m + 1]; ++j) {
+            if (mat.by_row()) {
+                output[m * mat.ncol() + i[j]] += x[j];
+            } else {
+                output[i[j] * mat.ncol() + m] += x[j];
+            }
+        }
+    }
+    return output; // row-major.
+}
+
+TEST(SparseMatrix, Basic) {
+    raiigraph::initialize();
+
+    raiigraph::SparseMatrix empty;
+    EXPECT_EQ(empty.nrow(), 0);
+    EXPECT_EQ(empty.ncol(), 0);
+    EXPECT_TRUE(empty.is_triplet());
+
+    raiigraph::SparseMatrix mat(3, 4, 5);
+    EXPECT_EQ(mat.nrow(), 3);
+    EXPECT_EQ(mat.ncol(), 4);
+    mat.add_entry(0, 1, 2.5);
+    mat.add_entry(2, 3, 1);
+    mat.add_entry(2, 3, 1); // duplicates are summed.
+    EXPECT_EQ(mat.nonzero_storage(), 3);
+
+    auto cmat = mat.compress();
+    EXPECT_TRUE(cmat.is_compressed());
+    EXPECT_FALSE(cmat.is_triplet());
+    EXPECT_EQ(cmat.nrow(), 3);
+
+    raiigraph::CompressedSparseMatrix csr(cmat);
+    EXPECT_EQ(csr.nonzeros(), 2);
+    auto dense = densify(csr);
+    EXPECT_EQ(dense[1], 2.5);
+    EXPECT_EQ(dense[2 * 4 + 3], 2);
+
+    raiigraph::CompressedSparseMatrix csc(mat, false);
+    EXPECT_EQ(densify(csc), dense);
+
+    // Copies and moves.
+    raiigraph::SparseMatrix copy(mat);
+    EXPECT_EQ(copy.nonzero_storage(), 3);
+    EXPECT_NE(copy.get(), mat.get());
+    copy = cmat;
+    EXPECT_TRUE(copy.is_compressed());
+
+    raiigraph::SparseMatrix moved(std::move(copy));
+    EXPECT_TRUE(moved.is_compressed());
+    EXPECT_EQ(copy.nrow(), 0); // re-initialized on use.
+    copy = std::move(moved);
+    EXPECT_EQ(copy.nrow(), 3);
+
+    // Const access to moved-from matrices does not re-initialize them.
+    raiigraph::SparseMatrix moved2(std::move(copy));
+    raiigraph::SparseMatrix moved3(std::move(moved2));
+    const auto& cref = copy;
+    const auto& cref2 = moved2;
+    EXPECT_EQ(cref.nrow(), 0);
+    EXPECT_EQ(cref.get(), cref2.get()); // both refer to the same empty placeholder.
+    EXPECT_EQ(moved3.nrow(), 3);
+}
+
+TEST(SparseMatrix, FromGraph) {
+    raiigraph::initialize();
+
+    std::vector<igraph_int_t> edges { 0, 1, 1, 2, 2, 0, 3, 3, 1, 2 }; // includes a self-loop and a multi-edge.
+    std::vector<double> weights { 1, 2, 3, 4, 5 };
+    raiigraph::RealVectorView wview(weights);
+
+    {
+        raiigraph::Graph graph(raiigraph::IntVectorView(edges), 4, IGRAPH_DIRECTED);
+        raiigraph::CompressedSparseMatrix csr(graph, wview);
+        EXPECT_TRUE(csr.by_row());
+        EXPECT_EQ(csr.nonzeros(), 4);
+        std::vector<double> expected {
+            0, 1, 0, 0,
+            0, 0, 7, 0,
+            3, 0, 0, 0,
+            0, 0, 0, 4
+        };
+        EXPECT_EQ(densify(csr), expected);
+
+        raiigraph::CompressedSparseMatrix csc(graph, wview, false);
+        EXPECT_FALSE(csc.by_row());
+        EXPECT_EQ(densify(csc), expected);
+
+        raiigraph::CompressedSparseMatrix unweighted(graph);
+        EXPECT_EQ(densify(unweighted)[1 * 4 + 2], 2);
+
+        // Consistent with igraph's own adjacency matrix.
+        raiigraph::SparseMatrix smat(graph, wview);
+        EXPECT_EQ(densify(raiigraph::CompressedSparseMatrix(smat)), expected);
+    }
+
+    {
+        raiigraph::Graph graph(raiigraph::IntVectorView(edges), 4, IGRAPH_UNDIRECTED);
+        raiigraph::CompressedSparseMatrix csr(graph, wview);
+        std::vector<double> expected {
+            0, 1, 3, 0,
+            1, 0, 7, 0,
+            3, 7, 0, 0,
+            0, 0, 0, 4
+        };
+        EXPECT_EQ(densify(csr), expected);
+
+        raiigraph::CompressedSparseMatrix twice(graph, wview, true, IGRAPH_LOOPS_TWICE);
+        EXPECT_EQ(densify(twice)[15], 8);
+        raiigraph::CompressedSparseMatrix none(graph, wview, true, IGRAPH_NO_LOOPS);
+        EXPECT_EQ(densify(none)[15], 0);
+        EXPECT_EQ(none.nonzeros(), 6);
+
+        // Round trip through igraph.
+        auto smat = csr.to_sparsemat();
+        EXPECT_TRUE(smat.is_compressed());
+        EXPECT_EQ(densify(raiigraph::CompressedSparseMatrix(smat, false)), expected);
+    }
+
+    raiigraph::Graph graph(raiigraph::IntVectorView(edges), 4, IGRAPH_UNDIRECTED);
+    std::vector<double> short_weights(2);
+    EXPECT_THROW(raiigraph::CompressedSparseMatrix(graph, raiigraph::RealVectorView(short_weights)), raiigraph::IgraphError);
+}
+
+TEST(SparseMatrix, Compressed) {
+    raiigraph::initialize();
+
+    std::vector<igraph_int_t> p { 0, 2, 2, 3 }, i { 0, 3, 1 };
+    std::vector<double> x { 1, 2, 3 };
+    raiigraph::CompressedSparseMatrix mat(3, 4, raiigraph::IntVector(p.begin(), p.end()), raiigraph::IntVector(i.begin(), i.end()), raiigraph::RealVector(x.begin(), x.end()), true);
+    EXPECT_EQ(mat.nrow(), 3);
+    EXPECT_EQ(mat.ncol(), 4);
+    EXPECT_EQ(mat.nonzeros(), 3);
+
+    // Zero-copy release of the arrays.
+    auto ptr = mat.values().data();
+    auto released = mat.release();
+    EXPECT_EQ(std::get<2>(released).data(), ptr);
+    EXPECT_EQ(std::get<0>(released).size(), 4);
+    EXPECT_EQ(mat.nrow(), 0);
+    EXPECT_EQ(mat.pointers().size(), 1);
+
+    EXPECT_THROW(raiigraph::CompressedSparseMatrix(3, 4, raiigraph::IntVector(3), raiigraph::IntVector(), raiigraph::RealVector(), true), raiigraph::IgraphError);
+    EXPECT_THROW(raiigraph::CompressedSparseMatrix(3, 4, raiigraph::IntVector(4), raiigraph::IntVector(1), raiigraph::RealVector(), true), raiigraph::IgraphError);
+
+    // Invalid structure.
+    auto build = [&](std::vector<igraph_int_t> p2, std::vector<igraph_int_t> i2, bool by_row) -> raiigraph::CompressedSparseMatrix {
+        return raiigraph::CompressedSparseMatrix(3, 4, raiigraph::IntVector(p2.begin(), p2.end()), raiigraph::IntVector(i2.begin(), i2.end()), raiigraph::RealVector(i2.size()), by_row);
+    };
+    EXPECT_NO_THROW(build({ 0, 2, 2, 3 }, { 0, 3, 1 }, true));
+    EXPECT_THROW(build({ 0, 3, 2, 3 }, { 0, 1, 3 }, true), raiigraph::IgraphError); // decreasing pointers.
+    EXPECT_THROW(build({ 0, 2, 2, 3 }, { 0, 4, 1 }, true), raiigraph::IgraphError); // index out of range.
+    EXPECT_THROW(build({ 0, 2, 2, 3 }, { 0, -1, 1 }, true), raiigraph::IgraphError);
+    EXPECT_THROW(build({ 0, 2, 2, 3 }, { 3, 0, 1 }, true), raiigraph::IgraphError); // unsorted.
+    EXPECT_THROW(build({ 0, 2, 2, 3 }, { 1, 1, 1 }, true), raiigraph::IgraphError); // duplicated.
+    EXPECT_NO_THROW(build({ 0, 1, 1, 2, 3 }, { 2, 0, 1 }, false));
+    EXPECT_THROW(build({ 0, 1, 1, 2, 3 }, { 2, 0, 3 }, false), raiigraph::IgraphError); // only 3 rows.
+
+    raiigraph::CompressedSparseMatrix empty;
+    EXPECT_EQ(empty.nrow(), 0);
+    EXPECT_EQ(empty.pointers().size(), 1);
+}
+
+TEST(SparseMatrix, Multiply) {
+    raiigraph::initialize();
+
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> unif;
+    raiigraph::SparseMatrix triplets(50, 30);
+    for (igraph_int_t r = 0; r < 50; ++r) {
+        for (igraph_int_t c = 0; c < 30; ++c) {
+            if (unif(rng) < 0.1) {
+                triplets.add_entry(r, c, unif(rng));
+            }
+        }
+    }
+
+    std::vector<double> x(30);
+    for (auto& v : x) {
+        v = unif(rng);
+    }
+
+    raiigraph::CompressedSparseMatrix csr(triplets, true);
+    auto dense = densify(csr);
+    std::vector<double> expected(50);
+    for (igraph_int_t r = 0; r < 50; ++r) {
+        for (igraph_int_t c = 0; c < 30; ++c) {
+            expected[r] += dense[r * 30 + c] * x[c];
+        }
+    }
+
+    raiigraph::CompressedSparseMatrix csc(triplets, false);
+    for (int nthreads : { 1, 3 }) {
+        raiigraph::RealVector y;
+        csr.multiply(x, y, nthreads);
+        EXPECT_EQ(y.size(), 50);
+        for (igraph_int_t r = 0; r < 50; ++r) {
+            EXPECT_NEAR(y[r], expected[r], 1e-8);
+        }
+
+        raiigraph::RealVector y2(100, 5); // contents are overwritten.
+        csc.multiply(raiigraph::RealVectorView(x), y2, nthreads);
+        EXPECT_EQ(y2.size(), 50);
+        for (igraph_int_t r = 0; r < 50; ++r) {
+            EXPECT_NEAR(y2[r], expected[r], 1e-8);
+        }
+    }
+
+    raiigraph::RealVector y;
+    std::vector<double> bad(10);
+    EXPECT_THROW(csr.multiply(bad, y), raiigraph::IgraphError);
+}
@@ -243,6 +243,141 @@ TEST(Vector, Resizing) {
     }
 }
 
+TEST(Vector, Uninitialized) {
+    raiigraph::initialize();
+
+    raiigraph::IntVector contents(100, raiigraph::uninitialized);
+    EXPECT_EQ(contents.size(), 100);
+    EXPECT_GE(contents.capacity(), 100);
+    std::iota(contents.begin(), contents.end(), 0);
+    EXPECT_EQ(contents.back(), 99);
+
+    contents.resize_uninitialized(200);
+    EXPECT_EQ(contents.size(), 200);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(contents[i], i);
+    }
+
+    contents.resize_uninitialized(50);
+    EXPECT_EQ(contents.size(), 50);
+    EXPECT_EQ(contents.back(), 49);
+
+    // Empty vectors are still valid.
+    raiigraph::RealVector empty(0, raiigraph::uninitialized);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(igraph_vector_size(empty), 0);
+    empty.push_back(1.5);
+    EXPECT_EQ(empty.front(), 1.5);
+
+    // Negative sizes are rejected.
+    EXPECT_THROW(raiigraph::IntVector(-1, raiigraph::uninitialized), raiigraph::IgraphError);
+}
+
+TEST(Vector, Release) {
+    raiigraph::initialize();
+
+    raiigraph::IntVector contents(10);
+    std::iota(contents.begin(), contents.end(), 0);
+    auto ptr = contents.data();
+
+    auto released = contents.release();
+    EXPECT_EQ(released.first.get(), ptr); // no copy.
+    EXPECT_EQ(released.second, 10);
+    EXPECT_EQ(released.first[9], 9);
+
+    // Vector is empty but still usable.
+    EXPECT_TRUE(contents.empty());
+    EXPECT_EQ(igraph_vector_int_size(contents), 0);
+    contents.push_back(1);
+    EXPECT_EQ(contents.size(), 1);
+
+    // Releasing from a moved-from vector gives a NULL pointer.
+    raiigraph::RealVector rcontents(5);
+    raiigraph::RealVector other(std::move(rcontents));
+    auto empty = rcontents.release();
+    EXPECT_TRUE(empty.first == nullptr);
+    EXPECT_EQ(empty.second, 0);
+}
+
+TEST(Vector, InsertOverlap) {
+    raiigraph::initialize();
+
+    // Using distinct values to check that the shifted elements are not clobbered.
+    std::vector<igraph_int_t> ref(20);
+    std::iota(ref.begin(), ref.end(), 0);
+    raiigraph::IntVector contents(ref.begin(), ref.end());
+
+    contents.insert(contents.begin() + 3, 5, -1);
+    ref.insert(ref.begin() + 3, 5, -1);
+    EXPECT_EQ(std::vector<igraph_int_t>(contents.begin(), contents.end()), ref);
+
+    std::vector<igraph_int_t> extra { 100, 101, 102, 103 };
+    contents.insert(contents.begin() + 10, extra.begin(), extra.end());
+    ref.insert(ref.begin() + 10, extra.begin(), extra.end());
+    EXPECT_EQ(std::vector<igraph_int_t>(contents.begin(), contents.end()), ref);
+
+    contents.insert(contents.begin(), -5);
+    ref.insert(ref.begin(), -5);
+    contents.insert(contents.end(), -6);
+    ref.insert(ref.end(), -6);
+    EXPECT_EQ(std::vector<igraph_int_t>(contents.begin(), contents.end()), ref);
+
+    // Inserting into a moved-from vector.
+    raiigraph::IntVector other(std::move(contents));
+    contents.insert(contents.begin(), 2, 7);
+    EXPECT_EQ(contents.size(), 2);
+    EXPECT_EQ(contents.back(), 7);
+}
+
+TEST(Vector, AppendRange) {
+    raiigraph::initialize();
+
+    raiigraph::IntVector contents;
+    std::vector<igraph_int_t> ref;
+    std::vector<igraph_int_t> chunk { 1, 2, 3 };
+
+    int reallocations = 0;
+    auto last_ptr = contents.data();
+    for (int i = 0; i < 1000; ++i) {
+        chunk[0] = i;
+        contents.append_range(chunk);
+        ref.insert(ref.end(), chunk.begin(), chunk.end());
+        if (contents.data() != last_ptr) {
+            ++reallocations;
+            last_ptr = contents.data();
+        }
+    }
+
+    EXPECT_EQ(std::vector<igraph_int_t>(contents.begin(), contents.end()), ref);
+    EXPECT_LT(reallocations, 20); // geometric growth.
+
+    // Appending from other raiigraph vectors.
+    raiigraph::IntVector more(5, 9);
+    contents.append_range(more);
+    EXPECT_EQ(contents.size(), 3005);
+    EXPECT_EQ(contents.back(), 9);
+}
+
+TEST(Vector, AssignRange) {
+    raiigraph::initialize();
+
+    raiigraph::RealVector contents(100, 1);
+    auto ptr = contents.data();
+
+    std::vector<double> values { 0.5, 1.5, 2.5 };
+    contents.assign_range(values);
+    EXPECT_EQ(std::vector<double>(contents.begin(), contents.end()), values);
+    EXPECT_EQ(contents.data(), ptr); // capacity is re-used.
+
+    std::vector<double> more(200, 3.5);
+    contents.assign_range(more);
+    EXPECT_EQ(std::vector<double>(contents.begin(), contents.end()), more);
+
+    raiigraph::RealVector other(std::move(contents));
+    contents.assign_range(values);
+    EXPECT_EQ(std::vector<double>(contents.begin(), contents.end()), values);
+}
+
 TEST(Vector, Coercion) {
     raiigraph::initialize();
 
@@ -266,6 +401,68 @@ TEST(Vector, Swap) {
     EXPECT_EQ(contents2[0], 0);
 }
 
+TEST(Vector, Move) {
+    raiigraph::initialize();
+
+    static_assert(std::is_nothrow_move_constructible<raiigraph::IntVector>::value);
+    static_assert(std::is_nothrow_move_assignable<raiigraph::IntVector>::value);
+
+    raiigraph::IntVector contents(10, 1);
+    auto ptr = contents.data();
+    raiigraph::IntVector moved(std::move(contents));
+    EXPECT_EQ(moved.data(), ptr); // no reallocation.
+    EXPECT_EQ(moved.size(), 10);
+
+    // Moved-from vector is empty and can still be used.
+    EXPECT_TRUE(contents.empty());
+    EXPECT_EQ(contents.size(), 0);
+    EXPECT_EQ(contents.capacity(), 0);
+    EXPECT_TRUE(contents.begin() == contents.end());
+    contents.push_back(5);
+    EXPECT_EQ(contents.size(), 1);
+    EXPECT_EQ(contents.front(), 5);
+
+    // Moved-from vectors are re-initialized when passed to igraph.
+    {
+        raiigraph::IntVector other(std::move(contents));
+        EXPECT_FALSE(contents.get() == NULL);
+        EXPECT_EQ(igraph_vector_int_size(contents), 0);
+
+        raiigraph::IntVector other2(std::move(other));
+        const auto& cref = other;
+        EXPECT_FALSE(cref.get() == NULL);
+        EXPECT_EQ(igraph_vector_int_size(cref), 0);
+        EXPECT_TRUE(cref.data() == NULL); // const access does not re-initialize the vector.
+    }
+
+    // Moved-from vectors can be assigned to.
+    {
+        raiigraph::IntVector other(std::move(moved));
+        moved = other;
+        EXPECT_EQ(moved.size(), 10);
+        EXPECT_EQ(moved.back(), 1);
+
+        raiigraph::IntVector other2(std::move(other));
+        other = std::move(other2);
+        EXPECT_EQ(other.size(), 10);
+    }
+
+    // Growth of a std::vector moves rather than copies.
+    {
+        std::vector<raiigraph::IntVector> collection;
+        std::vector<const igraph_int_t*> pointers;
+        for (int i = 0; i < 100; ++i) {
+            collection.emplace_back(5, i);
+            pointers.push_back(collection.back().data());
+        }
+
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(collection[i].data(), pointers[i]);
+            EXPECT_EQ(collection[i].front(), i);
+        }
+    }
+}
+
 TEST(Vector, OtherTypes) {
     raiigraph::initialize();
 
@@ -0,0 +1,93 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <numeric>
+
+TEST(VectorView, Construction) {
+    raiigraph::initialize();
+
+    raiigraph::IntVectorView empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_FALSE(empty.get() == NULL);
+    EXPECT_EQ(igraph_vector_int_size(empty), 0);
+
+    std::vector<igraph_int_t> values(10);
+    std::iota(values.begin(), values.end(), 0);
+
+    // No copy is made of the input.
+    raiigraph::IntVectorView view(values);
+    EXPECT_FALSE(view.empty());
+    EXPECT_EQ(view.size(), 10);
+    EXPECT_EQ(view.data(), values.data());
+    EXPECT_EQ(igraph_vector_int_size(view), 10);
+    EXPECT_EQ(igraph_vector_int_get(view, 5), 5);
+
+    raiigraph::IntVectorView pview(values.data() + 2, 5);
+    EXPECT_EQ(pview.size(), 5);
+    EXPECT_EQ(pview.front(), 2);
+    EXPECT_EQ(pview.back(), 6);
+
+    // Works with raiigraph vectors.
+    raiigraph::RealVector rvec(5, 2.5);
+    raiigraph::RealVectorView rview(rvec);
+    EXPECT_EQ(rview.data(), rvec.data());
+    EXPECT_EQ(rview.size(), 5);
+    EXPECT_EQ(igraph_vector_sum(rview), 12.5);
+
+    // Empty containers are still valid, even if their data() is NULL.
+    std::vector<igraph_real_t> nothing;
+    raiigraph::RealVectorView nview(nothing);
+    EXPECT_TRUE(nview.empty());
+    EXPECT_FALSE(nview.get() == NULL);
+    EXPECT_FALSE(nview.data() == NULL);
+}
+
+TEST(VectorView, Access) {
+    raiigraph::initialize();
+
+    std::vector<igraph_int_t> values(10);
+    std::iota(values.begin(), values.end(), 0);
+    raiigraph::IntVectorView view(values);
+
+    auto it = view.begin();
+    auto cit = view.cbegin();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(*it, i);
+        EXPECT_EQ(*cit, i);
+        EXPECT_EQ(view[i], i);
+        ++it;
+        ++cit;
+    }
+    EXPECT_TRUE(it == view.end());
+    EXPECT_TRUE(cit == view.cend());
+
+    auto rit = view.rbegin();
+    auto crit = view.crbegin();
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_EQ(*rit, 10 - i - 1);
+        EXPECT_EQ(*crit, 10 - i - 1);
+        ++rit;
+        ++crit;
+    }
+    EXPECT_TRUE(rit == view.rend());
+    EXPECT_TRUE(crit == view.crend());
+
+    EXPECT_EQ(std::accumulate(view.begin(), view.end(), 0), 45);
+
+    // View reflects changes to the underlying array.
+    values[0] = 100;
+    EXPECT_EQ(view.front(), 100);
+}
+
+TEST(VectorView, Coercion) {
+    raiigraph::initialize();
+
+    igraph_bool_t values[5] = { false, true, false, true, false };
+    raiigraph::BoolVectorView view(values, 5);
+    EXPECT_TRUE(view[1]);
+    EXPECT_EQ(view.get(), static_cast<const igraph_vector_bool_t*>(view));
+}
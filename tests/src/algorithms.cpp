@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/algorithms.hpp"
+#include "raiigraph/Vector.hpp"
+#include "raiigraph/Matrix.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <numeric>
+#include <functional>
+
+static std::vector<igraph_int_t> simulate(size_t n, int seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<igraph_int_t> output(n);
+    for (auto& o : output) {
+        o = rng() % 1000;
+    }
+    return output;
+}
+
+TEST(Algorithms, Sort) {
+    raiigraph::initialize();
+
+    for (int nthreads : { 1, 2, 3, 7 }) {
+        for (size_t n : { 0, 1, 5, 1000, 12345 }) {
+            auto ref = simulate(n, n + nthreads);
+            raiigraph::IntVector vec(ref.begin(), ref.end());
+            raiigraph::parallel_sort(vec, nthreads);
+            std::sort(ref.begin(), ref.end());
+            EXPECT_EQ(std::vector<igraph_int_t>(vec.begin(), vec.end()), ref);
+
+            // With a custom comparator.
+            raiigraph::parallel_sort(vec.begin(), vec.end(), nthreads, std::greater<igraph_int_t>());
+            std::reverse(ref.begin(), ref.end());
+            EXPECT_EQ(std::vector<igraph_int_t>(vec.begin(), vec.end()), ref);
+        }
+    }
+}
+
+TEST(Algorithms, SortView) {
+    raiigraph::initialize();
+
+    auto contents = simulate(2000, 42);
+    raiigraph::IntMatrix mat(20, 100);
+    std::copy(contents.begin(), contents.end(), mat.begin());
+
+    raiigraph::parallel_sort(mat.row(3), 4);
+    auto row = mat.row(3);
+    EXPECT_TRUE(std::is_sorted(row.begin(), row.end()));
+
+    // Other rows are untouched.
+    EXPECT_EQ(mat(4, 50), contents[4 + 50 * 20]);
+
+    std::vector<igraph_int_t> expected(row.begin(), row.end());
+    std::vector<igraph_int_t> original;
+    for (size_t c = 0; c < 100; ++c) {
+        original.push_back(contents[3 + c * 20]);
+    }
+    std::sort(original.begin(), original.end());
+    EXPECT_EQ(original, expected);
+}
+
+TEST(Algorithms, Transform) {
+    raiigraph::initialize();
+
+    auto ref = simulate(1001, 10);
+    for (int nthreads : { 1, 4 }) {
+        raiigraph::IntVector vec(ref.begin(), ref.end());
+        raiigraph::parallel_transform(vec, [](igraph_int_t x) -> igraph_int_t { return x * 2 + 1; }, nthreads);
+        for (size_t i = 0; i < ref.size(); ++i) {
+            EXPECT_EQ(vec[i], ref[i] * 2 + 1);
+        }
+
+        raiigraph::RealVector output(ref.size());
+        raiigraph::parallel_transform(vec.begin(), vec.end(), output.begin(), [](igraph_int_t x) -> double { return x / 2.0; }, nthreads);
+        EXPECT_EQ(output[5], vec[5] / 2.0);
+    }
+
+    raiigraph::RealMatrix mat(10, 20, 1);
+    raiigraph::parallel_transform(mat.column(2), [](double x) -> double { return x + 1; }, 3);
+    EXPECT_EQ(mat(5, 2), 2);
+    EXPECT_EQ(mat(5, 3), 1);
+}
+
+TEST(Algorithms, Fill) {
+    raiigraph::initialize();
+
+    raiigraph::RealVector vec(999);
+    raiigraph::parallel_fill(vec, 2.5, 4);
+    EXPECT_TRUE(std::all_of(vec.begin(), vec.end(), [](double x) -> bool { return x == 2.5; }));
+
+    raiigraph::parallel_fill(vec.begin() + 10, vec.begin() + 20, -1, 3);
+    EXPECT_EQ(vec[9], 2.5);
+    EXPECT_EQ(vec[10], -1);
+    EXPECT_EQ(vec[19], -1);
+    EXPECT_EQ(vec[20], 2.5);
+
+    raiigraph::IntMatrix mat(7, 9);
+    raiigraph::parallel_fill(mat.row(1), 5, 2);
+    EXPECT_EQ(mat(1, 8), 5);
+    EXPECT_EQ(mat(0, 8), 0);
+    EXPECT_EQ(mat(2, 0), 0);
+}
+
+TEST(Algorithms, Reduce) {
+    raiigraph::initialize();
+
+    auto ref = simulate(5000, 20);
+    raiigraph::IntVector vec(ref.begin(), ref.end());
+    auto expected = std::accumulate(ref.begin(), ref.end(), static_cast<igraph_int_t>(0));
+    for (int nthreads : { 1, 2, 5 }) {
+        EXPECT_EQ(raiigraph::parallel_reduce(vec, static_cast<igraph_int_t>(0), std::plus<igraph_int_t>(), nthreads), expected);
+        EXPECT_EQ(
+            raiigraph::parallel_reduce(vec.begin(), vec.end(), static_cast<igraph_int_t>(-1), [](igraph_int_t a, igraph_int_t b) -> igraph_int_t { return std::max(a, b); }, nthreads),
+            *std::max_element(ref.begin(), ref.end())
+        );
+    }
+
+    raiigraph::IntMatrix mat(10, 5, 2);
+    EXPECT_EQ(raiigraph::parallel_reduce(mat.row(0), static_cast<igraph_int_t>(0), std::plus<igraph_int_t>(), 3), 10);
+
+    // Works with boolean results, where each thread must write its own partial.
+    raiigraph::BoolVector flags(vec.size());
+    EXPECT_FALSE(raiigraph::parallel_reduce(flags, false, std::logical_or<bool>(), 4));
+    flags[flags.size() - 1] = true;
+    for (int nthreads : { 1, 3, 8 }) {
+        EXPECT_TRUE(raiigraph::parallel_reduce(flags, false, std::logical_or<bool>(), nthreads));
+        EXPECT_FALSE(raiigraph::parallel_reduce(flags, true, std::logical_and<bool>(), nthreads));
+    }
+
+    // Works with results that are not default-constructible.
+    struct Total {
+        explicit Total(igraph_int_t v) : value(v) {}
+        igraph_int_t value;
+    };
+    struct Combine {
+        Total operator()(const Total& left, igraph_int_t right) const { return Total(left.value + right); }
+        Total operator()(const Total& left, const Total& right) const { return Total(left.value + right.value); }
+    };
+    for (int nthreads : { 1, 3 }) {
+        EXPECT_EQ(raiigraph::parallel_reduce(vec, Total(0), Combine(), nthreads).value, expected);
+    }
+}
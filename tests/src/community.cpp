@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/community.hpp"
+#include "raiigraph/Graph.hpp"
+#include "raiigraph/RNGScope.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+
+// Two disjoint cliques of 5 vertices each.
+static raiigraph::Graph two_cliques() {
+    raiigraph::IntVector edges;
+    for (igraph_int_t offset : { 0, 5 }) {
+        for (igraph_int_t i = 0; i < 5; ++i) {
+            for (igraph_int_t j = 0; j < i; ++j) {
+                edges.push_back(offset + j);
+                edges.push_back(offset + i);
+            }
+        }
+    }
+    return raiigraph::Graph(edges, 10, false);
+}
+
+// Random graph without any real community structure, so different seeds give different partitions.
+static raiigraph::Graph random_graph(igraph_int_t nvertices, double prob, int seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> distu;
+    raiigraph::IntVector edges;
+    for (igraph_int_t i = 0; i < nvertices; ++i) {
+        for (igraph_int_t j = 0; j < i; ++j) {
+            if (distu(rng) < prob) {
+                edges.push_back(j);
+                edges.push_back(i);
+            }
+        }
+    }
+    return raiigraph::Graph(edges, nvertices, false);
+}
+
+static void expect_two_cliques(const raiigraph::IntVector& membership) {
+    ASSERT_EQ(membership.size(), 10);
+    for (igraph_int_t i = 1; i < 5; ++i) {
+        EXPECT_EQ(membership[i], membership[0]);
+        EXPECT_EQ(membership[i + 5], membership[5]);
+    }
+    EXPECT_NE(membership[0], membership[5]);
+}
+
+TEST(Community, Multilevel) {
+    raiigraph::initialize();
+    raiigraph::RNGScope scope(42);
+    auto graph = two_cliques();
+
+    auto res = raiigraph::cluster_multilevel(graph);
+    expect_two_cliques(res.membership);
+    EXPECT_FALSE(res.modularity.empty());
+    EXPECT_TRUE(res.levels.empty());
+
+    // Re-using the workspace.
+    raiigraph::RealVector weights(graph.ecount(), 1);
+    auto ptr = res.membership.data();
+    raiigraph::cluster_multilevel(graph, weights, 1, res, true);
+    expect_two_cliques(res.membership);
+    EXPECT_EQ(res.membership.data(), ptr);
+    EXPECT_EQ(res.levels.ncol(), 10);
+    EXPECT_EQ(res.levels.nrow(), res.modularity.size());
+}
+
+TEST(Community, Leiden) {
+    raiigraph::initialize();
+    raiigraph::RNGScope scope(42);
+    auto graph = two_cliques();
+
+    auto res = raiigraph::cluster_leiden(graph, NULL, 0.05, 0.01, -1);
+    expect_two_cliques(res.membership);
+    EXPECT_GE(res.nb_clusters, 2);
+
+    // Re-using the workspace and starting from the previous assignment.
+    auto ptr = res.membership.data();
+    raiigraph::cluster_leiden(graph, NULL, NULL, NULL, 0.05, 0.01, true, -1, res);
+    expect_two_cliques(res.membership);
+    EXPECT_EQ(res.membership.data(), ptr);
+    EXPECT_GE(res.nb_clusters, 2);
+}
+
+TEST(Community, LeidenSweep) {
+    raiigraph::initialize();
+
+    auto graph = two_cliques();
+    std::vector<igraph_real_t> resolutions { 0.05, 0.6, 0.8, 1.0, 0.1, 2.0, 0.7 };
+
+    auto ref = raiigraph::cluster_leiden_sweep(graph, NULL, resolutions, 42, 1);
+    EXPECT_EQ(ref.membership.nrow(), 10);
+    EXPECT_EQ(ref.membership.ncol(), resolutions.size());
+    EXPECT_EQ(ref.nb_clusters.size(), resolutions.size());
+    EXPECT_EQ(ref.quality.size(), resolutions.size());
+
+    // Same as running each resolution separately with its own RNG.
+    raiigraph::RNGStreamFactory factory(42);
+    for (std::size_t r = 0; r < resolutions.size(); ++r) {
+        raiigraph::RNGScope scope(factory, r);
+        auto single = raiigraph::cluster_leiden(graph, NULL, resolutions[r], 0.01, 2);
+        auto col = ref.membership.column(r);
+        EXPECT_EQ(std::vector<igraph_int_t>(col.begin(), col.end()), std::vector<igraph_int_t>(single.membership.begin(), single.membership.end()));
+        EXPECT_EQ(ref.nb_clusters[r], single.nb_clusters);
+        EXPECT_EQ(ref.quality[r], single.quality);
+    }
+
+    // Results do not depend on the number of threads, and the workspace can be re-used.
+    raiigraph::LeidenSweepResult workspace;
+    for (int nthreads : { 2, 3 }) {
+        raiigraph::cluster_leiden_sweep(graph, NULL, NULL, resolutions, 0.01, 2, 42, nthreads, workspace);
+        EXPECT_EQ(
+            std::vector<igraph_int_t>(workspace.membership.begin(), workspace.membership.end()),
+            std::vector<igraph_int_t>(ref.membership.begin(), ref.membership.end())
+        );
+        EXPECT_EQ(
+            std::vector<igraph_int_t>(workspace.nb_clusters.begin(), workspace.nb_clusters.end()),
+            std::vector<igraph_int_t>(ref.nb_clusters.begin(), ref.nb_clusters.end())
+        );
+    }
+
+    // No resolutions.
+    auto empty = raiigraph::cluster_leiden_sweep(graph, NULL, std::vector<igraph_real_t>(), 42, 2);
+    EXPECT_EQ(empty.membership.ncol(), 0);
+}
+
+TEST(Community, Consensus) {
+    raiigraph::initialize();
+    auto graph = two_cliques();
+
+    // Low resolution, so all runs should recover the cliques.
+    auto stable = raiigraph::cluster_leiden_consensus(graph, NULL, 10, 0.05, 42, 1);
+    expect_two_cliques(stable.membership);
+    EXPECT_EQ(stable.stability.size(), graph.ecount());
+    for (auto s : stable.stability) {
+        EXPECT_EQ(s, 1);
+    }
+
+    // Manual calculation of the stability, using a graph where the runs disagree.
+    auto noisy = random_graph(40, 0.3, 99);
+    igraph_int_t nruns = 10;
+    auto ref = raiigraph::cluster_leiden_consensus(noisy, NULL, nruns, 0.8, 100, 1);
+    std::vector<igraph_real_t> expected(noisy.ecount());
+    raiigraph::RNGStreamFactory factory(100);
+    for (igraph_int_t r = 0; r < nruns; ++r) {
+        raiigraph::RNGScope scope(factory, r);
+        auto single = raiigraph::cluster_leiden(noisy, NULL, 0.8, 0.01, 2);
+        for (auto edge : noisy.edges()) {
+            expected[edge.id] += (single.membership[edge.from] == single.membership[edge.to]);
+        }
+    }
+    igraph_int_t nintermediate = 0;
+    for (igraph_int_t e = 0; e < noisy.ecount(); ++e) {
+        EXPECT_FLOAT_EQ(ref.stability[e], expected[e] / nruns);
+        EXPECT_GE(ref.stability[e], 0);
+        EXPECT_LE(ref.stability[e], 1);
+        nintermediate += (ref.stability[e] > 0 && ref.stability[e] < 1);
+    }
+    EXPECT_GT(nintermediate, 0); // checking that we're actually aggregating different partitions.
+    EXPECT_EQ(ref.membership.size(), 40);
+
+    // Results do not depend on the number of threads, and the workspace can be re-used.
+    raiigraph::ConsensusResult workspace;
+    raiigraph::RealVector weights(noisy.ecount(), 1);
+    for (int nthreads : { 2, 3 }) {
+        raiigraph::cluster_leiden_consensus(noisy, weights, NULL, 0.8, 0.01, 2, nruns, 100, nthreads, workspace);
+        EXPECT_EQ(
+            std::vector<igraph_real_t>(workspace.stability.begin(), workspace.stability.end()),
+            std::vector<igraph_real_t>(ref.stability.begin(), ref.stability.end())
+        );
+        EXPECT_EQ(
+            std::vector<igraph_int_t>(workspace.membership.begin(), workspace.membership.end()),
+            std::vector<igraph_int_t>(ref.membership.begin(), ref.membership.end())
+        );
+    }
+
+    EXPECT_ANY_THROW(raiigraph::cluster_leiden_consensus(graph, NULL, 0));
+}
+
+TEST(Community, Walktrap) {
+    raiigraph::initialize();
+    auto graph = two_cliques();
+
+    auto res = raiigraph::cluster_walktrap(graph);
+    expect_two_cliques(res.membership);
+    EXPECT_EQ(res.merges.ncol(), 2);
+    EXPECT_LT(res.merges.nrow(), 10);
+    EXPECT_EQ(res.modularity.size(), res.merges.nrow() + 1);
+
+    auto ptr = res.membership.data();
+    raiigraph::cluster_walktrap(graph, NULL, 3, res);
+    expect_two_cliques(res.membership);
+    EXPECT_EQ(res.membership.data(), ptr);
+}
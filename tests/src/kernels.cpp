@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/kernels.hpp"
+#include "raiigraph/Vector.hpp"
+#include "raiigraph/VectorView.hpp"
+#include "raiigraph/Matrix.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <random>
+#include <type_traits>
+
+static std::vector<double> simulate(size_t n, int seed) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> dist;
+    std::vector<double> output(n);
+    for (auto& o : output) {
+        o = dist(rng);
+    }
+    return output;
+}
+
+TEST(Kernels, Sum) {
+    raiigraph::initialize();
+
+    for (size_t n : { 0, 1, 7, 8, 9, 100, 1001 }) {
+        auto ref = simulate(n, n);
+        raiigraph::RealVector vec(ref.begin(), ref.end());
+        EXPECT_NEAR(raiigraph::sum(vec), std::accumulate(ref.begin(), ref.end(), 0.0), 1e-8);
+
+        std::vector<igraph_int_t> iref(n);
+        std::iota(iref.begin(), iref.end(), -5);
+        raiigraph::IntVector ivec(iref.begin(), iref.end());
+        EXPECT_EQ(raiigraph::sum(ivec), std::accumulate(iref.begin(), iref.end(), static_cast<igraph_int_t>(0)));
+    }
+
+    // Works with views and matrices.
+    std::vector<igraph_int_t> values { 1, 2, 3, 4, 5, 6 };
+    EXPECT_EQ(raiigraph::sum(raiigraph::IntVectorView(values)), 21);
+    raiigraph::RealMatrix mat(3, 4, 0.5);
+    EXPECT_EQ(raiigraph::sum(mat), 6);
+
+    // Booleans are counted rather than OR'd together.
+    raiigraph::BoolVector bvec(20);
+    for (igraph_int_t i = 0; i < bvec.size(); i += 3) {
+        bvec[i] = true;
+    }
+    auto bsum = raiigraph::sum(bvec);
+    static_assert(std::is_same<decltype(bsum), igraph_int_t>::value);
+    EXPECT_EQ(bsum, 7);
+}
+
+TEST(Kernels, Dot) {
+    raiigraph::initialize();
+
+    for (size_t n : { 0, 5, 16, 123 }) {
+        auto left = simulate(n, n + 1);
+        auto right = simulate(n, n + 2);
+        raiigraph::RealVector lvec(left.begin(), left.end());
+        EXPECT_NEAR(raiigraph::dot(lvec, right), std::inner_product(left.begin(), left.end(), right.begin(), 0.0), 1e-8);
+    }
+
+    raiigraph::BoolVector bleft(20), bright(20);
+    for (size_t i = 0; i < 20; ++i) {
+        bleft[i] = (i % 2 == 0);
+        bright[i] = (i % 3 == 0);
+    }
+    EXPECT_EQ(raiigraph::dot(bleft, bright), 4);
+
+    raiigraph::RealVector x(10), y(11);
+    EXPECT_THROW(raiigraph::dot(x, y), raiigraph::IgraphError);
+}
+
+TEST(Kernels, WhichExtreme) {
+    raiigraph::initialize();
+
+    for (size_t n : { 1, 3, 8, 17, 200 }) {
+        auto ref = simulate(n, n + 10);
+        raiigraph::RealVector vec(ref.begin(), ref.end());
+
+        auto mn = raiigraph::which_min(vec);
+        auto it = std::min_element(ref.begin(), ref.end());
+        EXPECT_EQ(mn.first, it - ref.begin());
+        EXPECT_EQ(mn.second, *it);
+
+        auto mx = raiigraph::which_max(vec);
+        it = std::max_element(ref.begin(), ref.end());
+        EXPECT_EQ(mx.first, it - ref.begin());
+        EXPECT_EQ(mx.second, *it);
+    }
+
+    // Ties are resolved in favor of the first occurrence, even across lanes.
+    std::vector<igraph_int_t> ties(50, 5);
+    ties[13] = 1;
+    ties[22] = 1;
+    ties[3] = 9;
+    ties[45] = 9;
+    raiigraph::IntVector ivec(ties.begin(), ties.end());
+    EXPECT_EQ(raiigraph::which_min(ivec).first, 13);
+    EXPECT_EQ(raiigraph::which_max(ivec).first, 3);
+
+    ties[49] = -1;
+    ivec.back() = -1;
+    EXPECT_EQ(raiigraph::which_min(ivec).first, 49);
+
+    raiigraph::IntVector empty;
+    EXPECT_THROW(raiigraph::which_min(empty), raiigraph::IgraphError);
+}
+
+TEST(Kernels, Elementwise) {
+    raiigraph::initialize();
+
+    auto xref = simulate(37, 100);
+    auto yref = simulate(37, 101);
+    raiigraph::RealVector x(xref.begin(), xref.end());
+    raiigraph::RealVector y(yref.begin(), yref.end());
+
+    raiigraph::axpy(2.5, x, y);
+    for (size_t i = 0; i < yref.size(); ++i) {
+        EXPECT_DOUBLE_EQ(y[i], yref[i] + 2.5 * xref[i]);
+    }
+
+    raiigraph::scale(x, -2);
+    for (size_t i = 0; i < xref.size(); ++i) {
+        EXPECT_DOUBLE_EQ(x[i], -2 * xref[i]);
+    }
+
+    raiigraph::clamp(x, -1.0, 1.0);
+    for (size_t i = 0; i < xref.size(); ++i) {
+        EXPECT_DOUBLE_EQ(x[i], std::min(std::max(-2 * xref[i], -1.0), 1.0));
+    }
+
+    raiigraph::IntVector ivec(10, 3);
+    raiigraph::scale(ivec, 2);
+    EXPECT_EQ(ivec.front(), 6);
+    raiigraph::clamp(ivec, 0, 4);
+    EXPECT_EQ(ivec.back(), 4);
+
+    // Lossy conversions into integer or boolean containers are rejected at compile time.
+    static_assert(raiigraph::internal::kernel_exact_conversion<igraph_real_t, int>());
+    static_assert(raiigraph::internal::kernel_exact_conversion<igraph_int_t, int>());
+    static_assert(!raiigraph::internal::kernel_exact_conversion<igraph_int_t, double>());
+    static_assert(!raiigraph::internal::kernel_exact_conversion<igraph_bool_t, int>());
+
+    EXPECT_THROW(raiigraph::clamp(ivec, 5, 4), raiigraph::IgraphError);
+    raiigraph::RealVector short_y(2);
+    EXPECT_THROW(raiigraph::axpy(1, x, short_y), raiigraph::IgraphError);
+}
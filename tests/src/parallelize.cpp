@@ -0,0 +1,43 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/parallelize.hpp"
+
+#include <vector>
+#include <stdexcept>
+
+TEST(Parallelize, Basic) {
+    for (int nthreads : { 0, 1, 3, 8 }) {
+        for (igraph_int_t ntasks : { 0, 1, 5, 100 }) {
+            std::vector<int> visited(ntasks);
+            std::vector<int> used(std::max(nthreads, 1));
+            raiigraph::parallelize(nthreads, ntasks, [&](int t, igraph_int_t start, igraph_int_t length) -> void {
+                EXPECT_GT(length, 0);
+                ++used[t];
+                for (igraph_int_t i = start; i < start + length; ++i) {
+                    ++visited[i];
+                }
+            });
+
+            EXPECT_EQ(visited, std::vector<int>(ntasks, 1));
+            for (auto u : used) {
+                EXPECT_LE(u, 1);
+            }
+        }
+    }
+}
+
+TEST(Parallelize, Errors) {
+    EXPECT_THROW({
+        raiigraph::parallelize(4, 100, [&](int t, igraph_int_t, igraph_int_t) -> void {
+            if (t == 1) {
+                throw std::runtime_error("foo");
+            }
+        });
+    }, std::runtime_error);
+
+    EXPECT_THROW({
+        raiigraph::parallelize(1, 100, [&](int, igraph_int_t, igraph_int_t) -> void {
+            throw std::runtime_error("foo");
+        });
+    }, std::runtime_error);
+}
@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include "raiigraph/snn.hpp"
+#include "raiigraph/Matrix.hpp"
+#include "raiigraph/initialize.hpp"
+
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <unordered_map>
+
+static raiigraph::IntMatrix simulate_neighbors(igraph_int_t nobs, igraph_int_t k, int seed) {
+    std::mt19937_64 rng(seed);
+    raiigraph::IntMatrix output(nobs, k);
+    for (igraph_int_t i = 0; i < nobs; ++i) {
+        std::vector<igraph_int_t> chosen;
+        while (static_cast<igraph_int_t>(chosen.size()) < k) {
+            igraph_int_t candidate = rng() % nobs;
+            if (candidate != i && std::find(chosen.begin(), chosen.end(), candidate) == chosen.end()) {
+                chosen.push_back(candidate);
+            }
+        }
+        for (igraph_int_t r = 0; r < k; ++r) {
+            output(i, r) = chosen[r];
+        }
+    }
+    return output;
+}
+
+class SnnTest : public ::testing::TestWithParam<std::tuple<raiigraph::SnnWeightScheme, int> > {};
+
+TEST_P(SnnTest, Reference) {
+    raiigraph::initialize();
+
+    auto param = GetParam();
+    auto scheme = std::get<0>(param);
+    int nthreads = std::get<1>(param);
+
+    igraph_int_t nobs = 100, k = 5;
+    auto neighbors = simulate_neighbors(nobs, k, 42);
+    auto output = raiigraph::build_snn_graph(neighbors, scheme, nthreads);
+    EXPECT_EQ(output.graph.vcount(), nobs);
+    EXPECT_FALSE(output.graph.is_directed());
+    EXPECT_EQ(output.weights.size(), output.graph.ecount());
+
+    // Brute-force reference, where each observation is its own neighbor with rank 0.
+    std::vector<std::unordered_map<igraph_int_t, igraph_int_t> > ranks(nobs);
+    for (igraph_int_t i = 0; i < nobs; ++i) {
+        ranks[i][i] = 0;
+        for (igraph_int_t r = 0; r < k; ++r) {
+            ranks[i][neighbors(i, r)] = r + 1;
+        }
+    }
+
+    std::vector<igraph_int_t> expected_edges;
+    std::vector<igraph_real_t> expected_weights;
+    for (igraph_int_t j = 0; j < nobs; ++j) {
+        for (igraph_int_t other = 0; other < j; ++other) {
+            igraph_int_t count = 0, best = -1;
+            for (const auto& x : ranks[j]) {
+                auto found = ranks[other].find(x.first);
+                if (found != ranks[other].end()) {
+                    ++count;
+                    auto combined = x.second + found->second;
+                    if (best < 0 || combined < best) {
+                        best = combined;
+                    }
+                }
+            }
+            if (count == 0) {
+                continue;
+            }
+
+            expected_edges.push_back(other);
+            expected_edges.push_back(j);
+            igraph_real_t weight;
+            if (scheme == raiigraph::SnnWeightScheme::RANKED) {
+                weight = k - 0.5 * best;
+            } else if (scheme == raiigraph::SnnWeightScheme::NUMBER) {
+                weight = count;
+            } else {
+                weight = static_cast<double>(count) / (2 * (k + 1) - count);
+            }
+            expected_weights.push_back(std::max(weight, 1e-6));
+        }
+    }
+
+    std::vector<igraph_int_t> observed_edges;
+    for (auto edge : output.graph.edges()) {
+        observed_edges.push_back(edge.from);
+        observed_edges.push_back(edge.to);
+    }
+    EXPECT_EQ(observed_edges, expected_edges);
+
+    ASSERT_EQ(output.weights.size(), expected_weights.size());
+    for (std::size_t e = 0; e < expected_weights.size(); ++e) {
+        EXPECT_DOUBLE_EQ(output.weights[e], expected_weights[e]);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    Snn,
+    SnnTest,
+    ::testing::Combine(
+        ::testing::Values(raiigraph::SnnWeightScheme::RANKED, raiigraph::SnnWeightScheme::NUMBER, raiigraph::SnnWeightScheme::JACCARD),
+        ::testing::Values(1, 3)
+    )
+);
+
+TEST(Snn, EdgeCases) {
+    raiigraph::initialize();
+
+    // No neighbors, so no edges.
+    raiigraph::IntMatrix empty(10, 0);
+    auto output = raiigraph::build_snn_graph(empty);
+    EXPECT_EQ(output.graph.vcount(), 10);
+    EXPECT_EQ(output.graph.ecount(), 0);
+    EXPECT_TRUE(output.weights.empty());
+
+    // Mutual nearest neighbors.
+    std::vector<igraph_int_t> pairs { 1, 0 };
+    auto mutual = raiigraph::build_snn_graph(raiigraph::IntMatrixView(pairs, 2, 1), raiigraph::SnnWeightScheme::RANKED);
+    EXPECT_EQ(mutual.graph.ecount(), 1);
+    EXPECT_EQ(mutual.weights[0], 0.5); // k - 0.5 * (0 + 1).
+
+    std::vector<igraph_int_t> invalid { 1, 2 };
+    EXPECT_ANY_THROW(raiigraph::build_snn_graph(raiigraph::IntMatrixView(invalid, 2, 1)));
+
+    // Self-neighbors and duplicates are rejected.
+    std::vector<igraph_int_t> self { 0, 0 };
+    EXPECT_ANY_THROW(raiigraph::build_snn_graph(raiigraph::IntMatrixView(self, 2, 1)));
+    std::vector<igraph_int_t> duplicated { 1, 0, 0, 1, 2, 1 }; // column-major, so the first row has neighbors 1 and 1.
+    EXPECT_ANY_THROW(raiigraph::build_snn_graph(raiigraph::IntMatrixView(duplicated, 3, 2)));
+    duplicated[3] = 2;
+    EXPECT_NO_THROW(raiigraph::build_snn_graph(raiigraph::IntMatrixView(duplicated, 3, 2)));
+}